@@ -1,58 +1,43 @@
 #include <stdio.h>
 #include <string.h>
-#include  <ctype.h>
-#include "treeValidator.h"
-
-bool has_input_errors(const char* input) {
-    int len = strlen(input);
-    
-    if (len == 0) return true;
-    
-    for (int i = 0; i < len; i++) {
-        if (input[i] == '\n' || input[i] == '\r') return true;
-    }
-    
-    if (input[0] != '(' || input[len-1] != ')') return true;
-    
-    int open_count = 0, close_count = 0;
-    for (int i = 0; i < len; i++) {
-        if (input[i] == '(') open_count++;
-        else if (input[i] == ')') close_count++;
-    }
-    
-    if (open_count != close_count) return true;
-    
-    for (int i = 0; i < len; i++) {
-        if (!isalpha(input[i]) && input[i] != '(' && input[i] != ')' && input[i] != ' ') {
-            return true;
+#include "treeStream.h"
+
+int main(int argc, char* argv[]) {
+    FILE* fp = stdin;
+    bool interactive = true;
+
+    // Optional file argument: validate every line of the file
+    if (argc > 1) {
+        fp = fopen(argv[1], "r");
+        if (!fp) {
+            perror("Failed to open file");
+            return 1;
         }
+        interactive = false;
     }
-    
-    return false;
-}
 
-int main() {
-    char input[1000];
+    TreeStream stream;
+    tree_stream_init(&stream);
 
-    printf("Enter tree strings (type 'exit' to stop):\n");
+    if (interactive) printf("Enter tree strings (type 'exit' to stop):\n");
 
     while (1) {
-        printf(">> ");
-        if (fgets(input, sizeof(input), stdin)) {
-            input[strcspn(input, "\n")] = 0;
-
-            if (strcmp(input, "quit") == 0) break;
-            
-            // Check for basic input errors first
-            if (has_input_errors(input)) {
-                printf("ERROR\n\n");
-                continue;
-            }
-
-            bool result = is_valid_binary_tree(input);
-            printf("Result: %s\n\n", result ? "TRUE" : "FALSE");
+        if (interactive) printf(">> ");
+        if (!tree_stream_read_record(&stream, fp)) break;
+
+        if (tree_stream_is_quit(&stream)) break;
+
+        // Input checks and parsing are done while the record is read
+        TreeStreamResult result = tree_stream_finish(&stream);
+        if (result == TREE_STREAM_ERROR) {
+            printf("ERROR\n\n");
+            continue;
         }
+
+        printf("Result: %s\n\n", result == TREE_STREAM_TRUE ? "TRUE" : "FALSE");
     }
 
+    tree_stream_free(&stream);
+    if (fp != stdin) fclose(fp);
     return 0;
 }
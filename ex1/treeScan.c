@@ -0,0 +1,110 @@
+#include "treeScan.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SCAN_WIDTH 32
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define SCAN_WIDTH 16
+#endif
+
+void tree_scan_init(TreeScanState* st) {
+    st->open_count = 0;
+    st->close_count = 0;
+    st->illegal = false;
+    st->in_name = false;
+}
+
+static bool is_letter(unsigned char c) {
+    c |= 0x20;
+    return c >= 'a' && c <= 'z';
+}
+
+// Masks for one group of bytes, bit i describing buf[i]
+typedef struct {
+    unsigned int open;
+    unsigned int close;
+    unsigned int letter;
+    unsigned int space;
+} ScanMasks;
+
+#ifdef SCAN_WIDTH
+// Letters: (c | 0x20) - 'a' < 26, done as a signed compare after shifting
+// 'a' down to -128 because SSE2/AVX2 only have signed byte compares.
+#if SCAN_WIDTH == 32
+static ScanMasks classify(const char* p) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)p);
+    __m256i folded = _mm256_add_epi8(_mm256_or_si256(v, _mm256_set1_epi8(0x20)),
+                                     _mm256_set1_epi8((char)(0x80 - 'a')));
+    ScanMasks m;
+    m.open = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('(')));
+    m.close = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(')')));
+    m.space = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')));
+    m.letter = (unsigned int)_mm256_movemask_epi8(
+        _mm256_cmpgt_epi8(_mm256_set1_epi8((char)(-128 + 26)), folded));
+    return m;
+}
+#else
+static ScanMasks classify(const char* p) {
+    __m128i v = _mm_loadu_si128((const __m128i*)p);
+    __m128i folded = _mm_add_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)),
+                                  _mm_set1_epi8((char)(0x80 - 'a')));
+    ScanMasks m;
+    m.open = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('(')));
+    m.close = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(')')));
+    m.space = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')));
+    m.letter = (unsigned int)_mm_movemask_epi8(_mm_cmplt_epi8(folded, _mm_set1_epi8((char)(-128 + 26))));
+    return m;
+}
+#endif
+#endif
+
+// Fold one group of masks (width bits valid) into the state and emit
+// positions; returns the new position count.
+static int consume_masks(TreeScanState* st, ScanMasks m, int width, int base,
+                         unsigned short* positions, int n) {
+    unsigned int valid = width == 32 ? 0xFFFFFFFFu : (1u << width) - 1;
+
+    if (~(m.open | m.close | m.letter | m.space) & valid) st->illegal = true;
+    st->open_count += __builtin_popcount(m.open);
+    st->close_count += __builtin_popcount(m.close);
+
+    // A name starts at a letter whose previous byte is not a letter
+    unsigned int starts = m.letter & ~((m.letter << 1) | (st->in_name ? 1u : 0u));
+    st->in_name = (m.letter >> (width - 1)) & 1u;
+
+    unsigned int events = m.open | m.close | starts;
+    while (events) {
+        positions[n++] = (unsigned short)(base + __builtin_ctz(events));
+        events &= events - 1;
+    }
+    return n;
+}
+
+int tree_scan(TreeScanState* st, const char* buf, int len, unsigned short* positions) {
+    int n = 0;
+    int i = 0;
+
+#ifdef SCAN_WIDTH
+    for (; i + SCAN_WIDTH <= len; i += SCAN_WIDTH) {
+        n = consume_masks(st, classify(buf + i), SCAN_WIDTH, i, positions, n);
+    }
+#endif
+
+    // Tail (or everything, without SIMD) in groups of up to 32 bytes
+    while (i < len) {
+        int width = len - i < 32 ? len - i : 32;
+        ScanMasks m = { 0, 0, 0, 0 };
+        for (int j = 0; j < width; j++) {
+            unsigned char c = (unsigned char)buf[i + j];
+            unsigned int bit = 1u << j;
+            if (c == '(') m.open |= bit;
+            else if (c == ')') m.close |= bit;
+            else if (c == ' ') m.space |= bit;
+            else if (is_letter(c)) m.letter |= bit;
+        }
+        n = consume_masks(st, m, width, i, positions, n);
+        i += width;
+    }
+    return n;
+}
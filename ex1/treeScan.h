@@ -0,0 +1,24 @@
+#pragma once
+#include <stdbool.h>
+
+// Lexer pre-pass for tree strings. One sweep classifies every byte, counts
+// parentheses, flags illegal characters and records the structural
+// positions the parser needs: '(' , ')' and the first letter of each name.
+// Spaces and the rest of each name never reach the parser.
+//
+// Uses AVX2 or SSE2 when the compiler targets them, plain C otherwise.
+
+#define TREE_SCAN_BLOCK 4096
+
+typedef struct {
+    long long open_count;
+    long long close_count;
+    bool illegal;  // saw a byte that is not a letter, space or parenthesis
+    bool in_name;  // last byte scanned was a letter (names can span calls)
+} TreeScanState;
+
+void tree_scan_init(TreeScanState* st);
+
+// Scan len <= TREE_SCAN_BLOCK bytes. Offsets of structural bytes are written
+// to positions in increasing order; returns how many there are.
+int tree_scan(TreeScanState* st, const char* buf, int len, unsigned short* positions);
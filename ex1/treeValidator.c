@@ -1,105 +1,238 @@
 #include "treeValidator.h"
 #include <ctype.h>
 #include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
 
-static int index;
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
 
-static void skip_spaces(const char* str) {
-    while (str[index] == ' ') index++;
+#define CUR(v) ((v)->str[(v)->index])
+
+static void skip_spaces(TreeValidator* v) {
+    while (CUR(v) == ' ') v->index++;
 }
 
-static bool parse_node(const char* str);
+static bool parse_node(TreeValidator* v);
+
+static bool parse_token(TreeValidator* v) {
+    skip_spaces(v);
+    if (!isalpha((unsigned char)CUR(v))) return false;
 
-static bool parse_token(const char* str) {
-    skip_spaces(str);
-    if (!isalpha(str[index])) return false;
-    
-    while (isalpha(str[index])) index++;
+    while (isalpha((unsigned char)CUR(v))) v->index++;
     return true;
 }
 
-static bool parse_child(const char* str) {
-    skip_spaces(str);
-    
-    if (str[index] == '(') {
-        return parse_node(str);
+static bool parse_child(TreeValidator* v) {
+    skip_spaces(v);
+
+    if (CUR(v) == '(') {
+        return parse_node(v);
     } else {
-        if (!parse_token(str)) return false;
-        
-        skip_spaces(str);
-        
+        if (!parse_token(v)) return false;
+
+        skip_spaces(v);
+
         // Check if this token has children
-        if (str[index] == '(') {
-            index++; 
-            
+        if (CUR(v) == '(') {
+            v->index++;
+
             int child_count = 0;
             while (true) {
-                skip_spaces(str);
-                
-                if (str[index] == ')') {
-                    index++; // skip ')'
+                skip_spaces(v);
+
+                if (CUR(v) == ')') {
+                    v->index++; // skip ')'
                     break;
                 }
-                
-                if (!parse_child(str)) return false;
-                
+
+                if (!parse_child(v)) return false;
+
                 child_count++;
                 if (child_count > 2) return false; // Binary tree: max 2 children
             }
-            
+
             if (child_count == 0) return false; // Empty children list not allowed
         }
-        
+
         return true;
     }
 }
 
-static bool parse_node(const char* str) {
-    skip_spaces(str);
-    if (str[index] != '(') return false;
-    index++; // skip '('
-    
+static bool parse_node(TreeValidator* v) {
+    skip_spaces(v);
+    if (CUR(v) != '(') return false;
+    v->index++; // skip '('
+
     // Parse the node name
-    if (!parse_token(str)) return false;
-    
-    skip_spaces(str);
-    
+    if (!parse_token(v)) return false;
+
+    skip_spaces(v);
+
     // Check if there are children
-    if (str[index] == '(') {
-        index++; 
+    if (CUR(v) == '(') {
+        v->index++;
         int child_count = 0;
-        
+
         while (true) {
-            skip_spaces(str);
-            
+            skip_spaces(v);
+
             // End of children list
-            if (str[index] == ')') {
-                index++; // skip ')'
+            if (CUR(v) == ')') {
+                v->index++; // skip ')'
                 break;
             }
-            
-            if (!parse_child(str)) return false;
-            
+
+            if (!parse_child(v)) return false;
+
             child_count++;
             if (child_count > 2) return false; // Binary tree: max 2 children
         }
-        
+
         if (child_count == 0) return false; // Empty children list not allowed
     }
-    
-    skip_spaces(str);
-    if (str[index] != ')') return false;
-    index++; // skip ')'
-    
+
+    skip_spaces(v);
+    if (CUR(v) != ')') return false;
+    v->index++; // skip ')'
+
     return true;
 }
 
+bool is_valid_binary_tree_r(TreeValidator* v, const char* tree_string) {
+    v->str = tree_string;
+    v->index = 0;
+    skip_spaces(v);
+
+    if (!parse_node(v)) return false;
+
+    skip_spaces(v);
+    return CUR(v) == '\0';
+}
+
 bool is_valid_binary_tree(const char* tree_string) {
-    index = 0;
-    skip_spaces(tree_string);
-    
-    if (!parse_node(tree_string)) return false;
-    
-    skip_spaces(tree_string);
-    return tree_string[index] == '\0'; 
-}
\ No newline at end of file
+    TreeValidator v;
+    return is_valid_binary_tree_r(&v, tree_string);
+}
+
+// ==================== Parallel batch validation ====================
+
+// Each worker owns whole bytes of the bitmap (start is a multiple of 8),
+// so no two threads ever write the same byte.
+typedef struct {
+    const char* const* trees;
+    int start;
+    int end;
+    unsigned char* bitmap;
+    int valid_count;
+} BatchJob;
+
+static void run_batch_job(BatchJob* job) {
+    TreeValidator v;
+    job->valid_count = 0;
+    for (int i = job->start; i < job->end; i++) {
+        if (is_valid_binary_tree_r(&v, job->trees[i])) {
+            job->bitmap[i / 8] |= (unsigned char)(1u << (i % 8));
+            job->valid_count++;
+        }
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI batch_worker(LPVOID arg) {
+    run_batch_job((BatchJob*)arg);
+    return 0;
+}
+
+static int cpu_count(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+}
+#else
+static void* batch_worker(void* arg) {
+    run_batch_job((BatchJob*)arg);
+    return NULL;
+}
+
+static int cpu_count(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+}
+#endif
+
+int validate_tree_batch(const char* const trees[], int count, unsigned char* result_bitmap) {
+    if (count <= 0) return 0;
+    memset(result_bitmap, 0, (size_t)(count + 7) / 8);
+
+    int num_bytes = (count + 7) / 8;
+    int num_threads = cpu_count();
+    if (num_threads > num_bytes) num_threads = num_bytes;
+
+    BatchJob* jobs = (BatchJob*)malloc(sizeof(BatchJob) * num_threads);
+    if (!jobs) {
+        BatchJob job = { trees, 0, count, result_bitmap, 0 };
+        run_batch_job(&job);
+        return job.valid_count;
+    }
+
+    // Split on byte boundaries
+    int bytes_per_thread = num_bytes / num_threads;
+    int extra = num_bytes % num_threads;
+    int byte_pos = 0;
+    for (int t = 0; t < num_threads; t++) {
+        int nb = bytes_per_thread + (t < extra ? 1 : 0);
+        jobs[t].trees = trees;
+        jobs[t].bitmap = result_bitmap;
+        jobs[t].start = byte_pos * 8;
+        byte_pos += nb;
+        jobs[t].end = byte_pos * 8 < count ? byte_pos * 8 : count;
+        jobs[t].valid_count = 0;
+    }
+
+#ifdef _WIN32
+    HANDLE* handles = (HANDLE*)calloc(num_threads, sizeof(HANDLE));
+#else
+    pthread_t* handles = (pthread_t*)calloc(num_threads, sizeof(pthread_t));
+    bool* started = (bool*)calloc(num_threads, sizeof(bool));
+#endif
+
+    // Thread 0 runs on the calling thread; if a worker cannot be started
+    // its range is validated inline instead.
+    for (int t = 1; t < num_threads; t++) {
+#ifdef _WIN32
+        if (handles) handles[t] = CreateThread(NULL, 0, batch_worker, &jobs[t], 0, NULL);
+        if (!handles || !handles[t]) run_batch_job(&jobs[t]);
+#else
+        if (handles && started && pthread_create(&handles[t], NULL, batch_worker, &jobs[t]) == 0)
+            started[t] = true;
+        else
+            run_batch_job(&jobs[t]);
+#endif
+    }
+    run_batch_job(&jobs[0]);
+
+    int valid = jobs[0].valid_count;
+    for (int t = 1; t < num_threads; t++) {
+#ifdef _WIN32
+        if (handles && handles[t]) {
+            WaitForSingleObject(handles[t], INFINITE);
+            CloseHandle(handles[t]);
+        }
+#else
+        if (started && started[t]) pthread_join(handles[t], NULL);
+#endif
+        valid += jobs[t].valid_count;
+    }
+
+#ifndef _WIN32
+    free(started);
+#endif
+    free(handles);
+    free(jobs);
+    return valid;
+}
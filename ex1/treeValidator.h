@@ -1,4 +1,16 @@
 #pragma once
 #include <stdbool.h>
 
+// Parser state owned by the caller, so several threads can validate at once
+typedef struct {
+    const char* str;
+    int index;
+} TreeValidator;
+
 bool is_valid_binary_tree(const char* tree_string);
+bool is_valid_binary_tree_r(TreeValidator* v, const char* tree_string);
+
+// Validate count strings on all cores. Bit i of result_bitmap (LSB first,
+// (count + 7) / 8 bytes) is set when trees[i] is valid. Returns the number
+// of valid trees.
+int validate_tree_batch(const char* const trees[], int count, unsigned char* result_bitmap);
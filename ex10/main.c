@@ -3,6 +3,11 @@
 #include <string.h>
 #include <time.h>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define HAVE_X86_DISPATCH 1
+#endif
+
 #define MAX_LINE_LEN 200
 #define RANDOM_MAX 1000000LL
 #define MAX_TRIES 100 
@@ -86,6 +91,104 @@ long long sequential_search(const long long arr[], int size, long long key) {
     return -1;
 }
 
+// SIMD sequential search: 4 (AVX2) or 2 (SSE4.1) 64-bit keys per compare,
+// four vectors per iteration with one early-exit test. The kernel is chosen
+// once at run time; every kernel returns the index of the first match or -1.
+int find_ll_scalar(const long long arr[], int size, long long key) {
+    for (int i = 0; i < size; i++) {
+        if (arr[i] == key) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+#ifdef HAVE_X86_DISPATCH
+__attribute__((target("avx2")))
+int find_ll_avx2(const long long arr[], int size, long long key) {
+    __m256i k = _mm256_set1_epi64x(key);
+    int i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m256i e0 = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(arr + i)), k);
+        __m256i e1 = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(arr + i + 4)), k);
+        __m256i e2 = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(arr + i + 8)), k);
+        __m256i e3 = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(arr + i + 12)), k);
+        __m256i any = _mm256_or_si256(_mm256_or_si256(e0, e1), _mm256_or_si256(e2, e3));
+        if (!_mm256_testz_si256(any, any)) {
+            unsigned int m = (unsigned int)_mm256_movemask_pd(_mm256_castsi256_pd(e0)) |
+                             (unsigned int)_mm256_movemask_pd(_mm256_castsi256_pd(e1)) << 4 |
+                             (unsigned int)_mm256_movemask_pd(_mm256_castsi256_pd(e2)) << 8 |
+                             (unsigned int)_mm256_movemask_pd(_mm256_castsi256_pd(e3)) << 12;
+            return i + __builtin_ctz(m);
+        }
+    }
+    for (; i + 4 <= size; i += 4) {
+        __m256i e = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(arr + i)), k);
+        int m = _mm256_movemask_pd(_mm256_castsi256_pd(e));
+        if (m) {
+            return i + __builtin_ctz((unsigned int)m);
+        }
+    }
+    for (; i < size; i++) {
+        if (arr[i] == key) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+__attribute__((target("sse4.1")))
+int find_ll_sse41(const long long arr[], int size, long long key) {
+    __m128i k = _mm_set1_epi64x(key);
+    int i = 0;
+    for (; i + 8 <= size; i += 8) {
+        __m128i e0 = _mm_cmpeq_epi64(_mm_loadu_si128((const __m128i*)(arr + i)), k);
+        __m128i e1 = _mm_cmpeq_epi64(_mm_loadu_si128((const __m128i*)(arr + i + 2)), k);
+        __m128i e2 = _mm_cmpeq_epi64(_mm_loadu_si128((const __m128i*)(arr + i + 4)), k);
+        __m128i e3 = _mm_cmpeq_epi64(_mm_loadu_si128((const __m128i*)(arr + i + 6)), k);
+        __m128i any = _mm_or_si128(_mm_or_si128(e0, e1), _mm_or_si128(e2, e3));
+        if (!_mm_testz_si128(any, any)) {
+            unsigned int m = (unsigned int)_mm_movemask_pd(_mm_castsi128_pd(e0)) |
+                             (unsigned int)_mm_movemask_pd(_mm_castsi128_pd(e1)) << 2 |
+                             (unsigned int)_mm_movemask_pd(_mm_castsi128_pd(e2)) << 4 |
+                             (unsigned int)_mm_movemask_pd(_mm_castsi128_pd(e3)) << 6;
+            return i + __builtin_ctz(m);
+        }
+    }
+    for (; i < size; i++) {
+        if (arr[i] == key) {
+            return i;
+        }
+    }
+    return -1;
+}
+#endif
+
+typedef int (*FindLLFn)(const long long arr[], int size, long long key);
+
+FindLLFn resolve_find_ll() {
+#ifdef HAVE_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return find_ll_avx2;
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        return find_ll_sse41;
+    }
+#endif
+    return find_ll_scalar;
+}
+
+// Same result as sequential_search: comparisons up to the match, or -1
+long long sequential_search_simd(const long long arr[], int size, long long key) {
+    static FindLLFn find = NULL;
+    if (find == NULL) {
+        find = resolve_find_ll();
+    }
+    int index = find(arr, size, key);
+    return index >= 0 ? (long long)index + 1 : -1;
+}
+
 // Swap
 void swap(long long* a, long long* b) {
     long long t = *a;
@@ -157,7 +260,7 @@ int main() {
         search_key = search_key % RANDOM_MAX;
 
         
-        seq_comparisons = sequential_search(original_scores, num_students, search_key);
+        seq_comparisons = sequential_search_simd(original_scores, num_students, search_key);
         
         if (seq_comparisons != -1) {
             printf("랜덤 수: %lld (0 ~ %lld)\n", search_key, RANDOM_MAX);
@@ -172,6 +275,12 @@ int main() {
         return 1; 
     }
 
+    // Check the SIMD kernel once against the scalar reference
+    long long scalar_comparisons = sequential_search(original_scores, num_students, search_key);
+    if (scalar_comparisons != seq_comparisons) {
+        printf("Sequential Search 결과 불일치: SIMD %lld, 스칼라 %lld\n", seq_comparisons, scalar_comparisons);
+    }
+
     long long* sorted_scores = malloc(sizeof(long long) * num_students);
     if (!sorted_scores) {
         perror("Memory allocation failed for sorted array");
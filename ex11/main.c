@@ -5,6 +5,8 @@
 
 #define MAX_NAME_LEN 50
 #define MAX_LINE_LEN 200
+#define SEARCH_GROUP 16
+#define BATCH_SIZE 256
 
 typedef struct
 {
@@ -28,6 +30,7 @@ typedef struct AVLNode
     struct AVLNode *left;
     struct AVLNode *right;
     int height;
+    int pooled; // part of a bulk-load pool, freed with the pool
 } AVLNode;
 
 // Utility functions
@@ -46,8 +49,12 @@ AVLNode *new_node(Student s);
 AVLNode *right_rotate(AVLNode *y);
 AVLNode *left_rotate(AVLNode *x);
 AVLNode *insert_avl(AVLNode *node, Student s, PerformanceMetrics *metrics);
+int is_sorted_by_id(const Student *arr, int n);
+AVLNode *build_avl_sorted(const Student *sorted, int n, AVLNode **pool);
 Student *avl_search(AVLNode *root, int target_id, PerformanceMetrics *metrics);
+void avl_search_batch(AVLNode *root, const int *target_ids, int n, Student **results, long long *comparisons);
 AVLNode *avl_delete(AVLNode *node, int target_id, PerformanceMetrics *metrics, int *found); 
+void release_node(AVLNode *node);
 void free_avl_tree(AVLNode *root);
 
 // Array functions
@@ -177,6 +184,7 @@ AVLNode *new_node(Student s)
     node->data = s;
     node->left = node->right = NULL;
     node->height = 1;
+    node->pooled = 0;
     return node;
 }
 
@@ -266,6 +274,55 @@ AVLNode *insert_avl(AVLNode *node, Student s, PerformanceMetrics *metrics)
     return node;
 }
 
+int is_sorted_by_id(const Student *arr, int n)
+{
+    for (int i = 1; i < n; i++)
+    {
+        if (arr[i].id <= arr[i - 1].id)
+            return 0;
+    }
+    return 1;
+}
+
+// Middle record of each range becomes the subtree root, so the tree comes
+// out perfectly balanced with no rotations; pool[i] holds sorted[i].
+AVLNode *build_avl_range(AVLNode *pool, const Student *sorted, int lo, int hi)
+{
+    if (lo >= hi)
+    {
+        return NULL;
+    }
+
+    int mid = lo + (hi - lo) / 2;
+    AVLNode *node = &pool[mid];
+    node->data = sorted[mid];
+    node->left = build_avl_range(pool, sorted, lo, mid);
+    node->right = build_avl_range(pool, sorted, mid + 1, hi);
+    node->height = 1 + max(get_height(node->left), get_height(node->right));
+    node->pooled = 1;
+    return node;
+}
+
+// O(n) bulk load from records with strictly ascending ids into one
+// contiguous pool. Returns the root; *pool must be freed after
+// free_avl_tree. Later inserts and deletes work as usual.
+AVLNode *build_avl_sorted(const Student *sorted, int n, AVLNode **pool)
+{
+    *pool = NULL;
+    if (n <= 0)
+    {
+        return NULL;
+    }
+
+    *pool = (AVLNode *)malloc(sizeof(AVLNode) * n);
+    if (!*pool)
+    {
+        perror("Memory allocation failed for AVL pool");
+        return NULL;
+    }
+    return build_avl_range(*pool, sorted, 0, n);
+}
+
 Student *avl_search(AVLNode *root, int target_id, PerformanceMetrics *metrics)
 {
     if (metrics) metrics->comparisons = 0;
@@ -290,6 +347,74 @@ Student *avl_search(AVLNode *root, int target_id, PerformanceMetrics *metrics)
     return NULL;
 }
 
+// Looks up a batch of ids with SEARCH_GROUP descents interleaved: each step
+// moves one descent down a level and prefetches its next node, so the
+// other lanes' work hides that miss. A finished lane takes the next id.
+// results[i] and comparisons[i] match what avl_search gives for target_ids[i].
+void avl_search_batch(AVLNode *root, const int *target_ids, int n, Student **results, long long *comparisons)
+{
+    AVLNode *cur[SEARCH_GROUP];
+    int lane[SEARCH_GROUP];
+    int active = 0;
+    int next = 0;
+
+    for (; active < SEARCH_GROUP && next < n; active++, next++)
+    {
+        lane[active] = next;
+        cur[active] = root;
+        results[next] = NULL;
+        comparisons[next] = 0;
+    }
+
+    while (active > 0)
+    {
+        int s = 0;
+        while (s < active)
+        {
+            int k = lane[s];
+            AVLNode *node = cur[s];
+            if (node != NULL)
+            {
+                comparisons[k]++;
+                if (node->data.id == target_ids[k])
+                {
+                    results[k] = &node->data;
+                    node = NULL;
+                }
+                else if (target_ids[k] < node->data.id)
+                {
+                    node = node->left;
+                }
+                else
+                {
+                    node = node->right;
+                }
+            }
+
+            if (node != NULL)
+            {
+                __builtin_prefetch(node);
+                cur[s++] = node;
+            }
+            else if (next < n)
+            {
+                lane[s] = next;
+                cur[s++] = root;
+                results[next] = NULL;
+                comparisons[next] = 0;
+                next++;
+            }
+            else
+            {
+                // Retire the lane; the last active one moves into its place
+                active--;
+                lane[s] = lane[active];
+                cur[s] = cur[active];
+            }
+        }
+    }
+}
+
 AVLNode *avl_delete(AVLNode *node, int target_id, PerformanceMetrics *metrics, int *found)
 {
     if (node == NULL)
@@ -314,13 +439,13 @@ AVLNode *avl_delete(AVLNode *node, int target_id, PerformanceMetrics *metrics, i
         if (node->left == NULL)
         {
             AVLNode *temp = node->right;
-            free(node);
+            release_node(node);
             return temp;
         }
         else if (node->right == NULL)
         {
             AVLNode *temp = node->left;
-            free(node);
+            release_node(node);
             return temp;
         }
 
@@ -363,13 +488,21 @@ AVLNode *avl_delete(AVLNode *node, int target_id, PerformanceMetrics *metrics, i
     return node;
 }
 
+void release_node(AVLNode *node)
+{
+    if (!node->pooled)
+    {
+        free(node);
+    }
+}
+
 void free_avl_tree(AVLNode *root)
 {
     if (root != NULL)
     {
         free_avl_tree(root->left);
         free_avl_tree(root->right);
-        free(root);
+        release_node(root);
     }
 }
 
@@ -570,12 +703,20 @@ int main()
     int sorted_capacity = student_count;
     shell_sort(sorted_arr, sorted_count, compare_id_asc); 
 
-    // AVL Tree
+    // AVL Tree: bulk load when the file is already in id order
     AVLNode *avl_root = NULL;
-    for (int i = 0; i < student_count; i++)
+    AVLNode *avl_pool = NULL;
+    if (is_sorted_by_id(all_students, student_count))
     {
-        PerformanceMetrics temp_metrics = {0}; 
-        avl_root = insert_avl(avl_root, all_students[i], &temp_metrics);
+        avl_root = build_avl_sorted(all_students, student_count, &avl_pool);
+    }
+    if (!avl_root)
+    {
+        for (int i = 0; i < student_count; i++)
+        {
+            PerformanceMetrics temp_metrics = {0}; 
+            avl_root = insert_avl(avl_root, all_students[i], &temp_metrics);
+        }
     }
     
     PerformanceMetrics metrics = {0};
@@ -601,6 +742,24 @@ int main()
     result = avl_search(avl_root, target_id, &metrics); 
     printf("AVL Tree:                           %s | 비교 횟수: %lld\n", result ? "Found" : "Not Found", metrics.comparisons);
 
+    // AVL Tree (Batch search): random ids, roughly half of them present
+    int batch_ids[BATCH_SIZE];
+    Student *batch_results[BATCH_SIZE];
+    long long batch_comparisons[BATCH_SIZE];
+    for (int i = 0; i < BATCH_SIZE; i++)
+    {
+        batch_ids[i] = (i % 2 == 0) ? all_students[rand() % student_count].id : rand();
+    }
+    avl_search_batch(avl_root, batch_ids, BATCH_SIZE, batch_results, batch_comparisons);
+    int batch_found = 0;
+    long long batch_total = 0;
+    for (int i = 0; i < BATCH_SIZE; i++)
+    {
+        batch_found += batch_results[i] != NULL;
+        batch_total += batch_comparisons[i];
+    }
+    printf("AVL Tree (배치 %d개):                 %d Found | 평균 비교 횟수: %.2f\n", BATCH_SIZE, batch_found, (double)batch_total / BATCH_SIZE);
+
     //삽입
     printf("\n삽입 ID %d ---\n", new_student.id);
 
@@ -644,6 +803,7 @@ int main()
     free(unsorted_arr);
     free(sorted_arr);
     free_avl_tree(avl_root);
+    free(avl_pool);
 
     return 0;
 }
\ No newline at end of file
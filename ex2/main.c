@@ -1,84 +1,58 @@
 #include <stdio.h>
 #include <string.h>
-#include <ctype.h>
-#include "treeFunction.h"
+#include "treeStream.h"
 
-bool has_input_errors(const char *input)
+int main(int argc, char *argv[])
 {
-    int len = strlen(input);
+    FILE *fp = stdin;
+    bool interactive = true;
 
-    if (len == 0)
-        return true;
-
-    for (int i = 0; i < len; i++)
-    {
-        if (input[i] == '\n' || input[i] == '\r')
-            return true;
-    }
-
-    if (input[0] != '(' || input[len - 1] != ')')
-        return true;
-
-    int open_count = 0, close_count = 0;
-    for (int i = 0; i < len; i++)
-    {
-        if (input[i] == '(')
-            open_count++;
-        else if (input[i] == ')')
-            close_count++;
-    }
-
-    if (open_count != close_count)
-        return true;
-
-    for (int i = 0; i < len; i++)
+    // Optional file argument: analyze every line of the file
+    if (argc > 1)
     {
-        if (!isalpha(input[i]) && input[i] != '(' && input[i] != ')' && input[i] != ' ')
+        fp = fopen(argv[1], "r");
+        if (!fp)
         {
-            return true;
+            perror("Failed to open file");
+            return 1;
         }
+        interactive = false;
     }
 
-    return false;
-}
-
-int main()
-{
-    char input[1000];
+    TreeStream stream;
+    tree_stream_init(&stream);
 
-    printf("Enter tree strings (type 'exit' to stop):\n");
+    if (interactive)
+        printf("Enter tree strings (type 'exit' to stop):\n");
 
     while (1)
     {
-        printf(">> ");
-        if (fgets(input, sizeof(input), stdin))
+        if (interactive)
+            printf(">> ");
+        if (!tree_stream_read_record(&stream, fp))
+            break;
+
+        if (tree_stream_is_quit(&stream))
+            break;
+
+        // Input checks, parsing and height/node/leaf counts are all
+        // computed while the record is read, so no line buffer is needed
+        TreeStreamResult result = tree_stream_finish(&stream);
+        if (result == TREE_STREAM_ERROR)
         {
-            input[strcspn(input, "\n")] = 0;
-
-            if (strcmp(input, "quit") == 0)
-                break;
-
-            // Check for basic input errors first
-            if (has_input_errors(input))
-            {
-                printf("ERROR\n\n");
-                continue;
-            }
-
-            bool result = is_valid_binary_tree(input);
-            printf("Result: %s\n\n", result ? "TRUE" : "FALSE");
-            if (result)
-            {
-                TreeNode *root = parse_and_build_tree(input);
-                int height = calculate_height(root);
-                int total_nodes = count_nodes(root);
-                int terminal_nodes = count_terminal_nodes(root);
-                printf("%d, %d, %d\n\n", height, total_nodes, terminal_nodes);
+            printf("ERROR\n\n");
+            continue;
+        }
 
-                free_tree(root);
-            }
+        printf("Result: %s\n\n", result == TREE_STREAM_TRUE ? "TRUE" : "FALSE");
+        if (result == TREE_STREAM_TRUE)
+        {
+            printf("%d, %lld, %lld\n\n", stream.height, stream.nodes, stream.leaves);
         }
     }
 
+    tree_stream_free(&stream);
+    if (fp != stdin)
+        fclose(fp);
     return 0;
 }
@@ -3,142 +3,299 @@
 #include <stdlib.h>
 #include <string.h>
 
-static int index;
+typedef struct {
+    const char* str;
+    int index;
+    TreeStats* stats;
+    TreeArena* arena;  // NULL: one malloc per node
+} TreeParser;
 
-static void skip_spaces(const char* str) {
-    while (str[index] == ' ') index++;
+static void skip_spaces(TreeParser* p) {
+    while (p->str[p->index] == ' ') p->index++;
 }
 
-// Create a new tree node
-static TreeNode* create_node(const char* data) {
-    TreeNode* node = (TreeNode*)malloc(sizeof(TreeNode));
+// Create a new tree node from the first len characters of data. The label
+// is stored right behind the node, in the same block.
+static TreeNode* create_node(TreeArena* arena, const char* data, int len) {
+    size_t size = sizeof(TreeNode) + (size_t)len + 1;
+    TreeNode* node = (TreeNode*)(arena ? tree_arena_alloc(arena, size) : malloc(size));
     if (node) {
-        strcpy(node->data, data);
+        node->data = (char*)(node + 1);
+        memcpy(node->data, data, len);
+        node->data[len] = '\0';
         node->left = NULL;
         node->right = NULL;
     }
     return node;
 }
 
-// Parse token - simplified since input is already validated
-static void parse_token(const char* str, char* token) {
-    skip_spaces(str);
-    int token_len = 0;
-    while (isalpha(str[index])) {
-        token[token_len++] = str[index++];
+// The parser validates and builds at the same time. Every check that fails
+// stops with p->index still on the offending character, and every node is
+// linked into its parent as soon as it exists so one free_tree on the root
+// cleans up a partial tree.
+//
+// Nesting is kept on an explicit stack instead of the call stack, so a
+// degenerate tree hundreds of thousands of levels deep only costs heap.
+
+enum { KIND_PAREN, KIND_BARE };  // "(A ...)" or a bare child token "A (...)"
+enum { ST_NAME, ST_LIST, ST_CLOSE };
+
+typedef struct {
+    TreeNode* node;
+    unsigned char kind;
+    unsigned char state;
+    unsigned char children;
+} ParseFrame;
+
+// Parse a node name and count the new node at the given depth
+static TreeNode* parse_name(TreeParser* p, int depth) {
+    skip_spaces(p);
+    int start = p->index;
+    if (!isalpha((unsigned char)p->str[p->index])) return NULL;
+
+    while (isalpha((unsigned char)p->str[p->index])) p->index++;
+
+    TreeNode* node = create_node(p->arena, p->str + start, p->index - start);
+    if (!node) {
+        p->index = start;
+        return NULL;
     }
-    token[token_len] = '\0';
+    p->stats->nodes++;
+    if (depth > p->stats->height) p->stats->height = depth;
+    return node;
 }
 
-// Forward declaration
-static TreeNode* build_node(const char* str);
-
-// Build child node - simplified since we know input is valid
-static TreeNode* build_child(const char* str) {
-    skip_spaces(str);
-    
-    if (str[index] == '(') {
-        // Child is a full node
-        return build_node(str);
-    } else {
-        // Child is a simple token
-        char token[100];
-        parse_token(str, token);
-        TreeNode* node = create_node(token);
-        
-        skip_spaces(str);
-        
-        // Check if this token has children
-        if (str[index] == '(') {
-            index++; // skip '('
-            
-            // Parse first child
-            skip_spaces(str);
-            if (str[index] != ')') {
-                node->left = build_child(str);
-                
-                // Parse second child if exists
-                skip_spaces(str);
-                if (str[index] != ')') {
-                    node->right = build_child(str);
-                }
-            }
-            
-            skip_spaces(str);
-            index++; // skip ')'
-        }
-        
-        return node;
+static bool push_frame(ParseFrame** frames, int* depth, int* capacity, unsigned char kind) {
+    if (*depth == *capacity) {
+        int new_capacity = *capacity ? *capacity * 2 : 64;
+        ParseFrame* temp = (ParseFrame*)realloc(*frames, sizeof(ParseFrame) * new_capacity);
+        if (!temp) return false;
+        *frames = temp;
+        *capacity = new_capacity;
     }
+    ParseFrame* f = &(*frames)[(*depth)++];
+    f->node = NULL;
+    f->kind = kind;
+    f->state = ST_NAME;
+    f->children = 0;
+    return true;
 }
 
-static TreeNode* build_node(const char* str) {
-    skip_spaces(str);
-    index++; // skip '('
-    
-    // Parse node name
-    char node_name[100];
-    parse_token(str, node_name);
-    TreeNode* node = create_node(node_name);
-    
-    skip_spaces(str);
-    
-    // Check if there are children
-    if (str[index] == '(') {
-        index++; // skip '('
-        
-        // Parse first child
-        skip_spaces(str);
-        if (str[index] != ')') {
-            node->left = build_child(str);
-            
-            // Parse second child if exists
-            skip_spaces(str);
-            if (str[index] != ')') {
-                node->right = build_child(str);
+static bool parse_tree(TreeParser* p, TreeNode** root) {
+    ParseFrame* frames = NULL;
+    int depth = 0;
+    int capacity = 0;
+    bool ok = false;
+
+    skip_spaces(p);
+    if (p->str[p->index] != '(') goto done;
+    p->index++; // skip '('
+    if (!push_frame(&frames, &depth, &capacity, KIND_PAREN)) goto done;
+
+    while (depth > 0) {
+        ParseFrame* f = &frames[depth - 1];
+
+        switch (f->state) {
+        case ST_NAME: {
+            TreeNode* node = parse_name(p, depth - 1);
+            if (!node) goto done;
+            f->node = node;
+
+            // Link into the parent: first child left, second right
+            if (depth == 1) {
+                *root = node;
+            } else {
+                ParseFrame* parent = &frames[depth - 2];
+                if (parent->children == 1) parent->node->left = node;
+                else parent->node->right = node;
             }
+
+            skip_spaces(p);
+            if (p->str[p->index] == '(') {
+                p->index++; // skip '('
+                f->state = ST_LIST;
+            } else {
+                p->stats->terminal_nodes++;
+                if (f->kind == KIND_BARE) depth--;
+                else f->state = ST_CLOSE;
+            }
+            break;
+        }
+
+        case ST_LIST:
+            skip_spaces(p);
+            if (p->str[p->index] == ')') {
+                if (f->children == 0) goto done; // Empty children list not allowed
+                p->index++; // skip ')'
+                if (f->kind == KIND_BARE) depth--;
+                else f->state = ST_CLOSE;
+                break;
+            }
+
+            if (f->children == 2) goto done; // Binary tree: max 2 children
+            f->children++;
+
+            if (p->str[p->index] == '(') {
+                // Child is a full node
+                p->index++; // skip '('
+                if (!push_frame(&frames, &depth, &capacity, KIND_PAREN)) goto done;
+            } else {
+                // Child is a token, possibly followed by its own children
+                if (!push_frame(&frames, &depth, &capacity, KIND_BARE)) goto done;
+            }
+            break;
+
+        case ST_CLOSE:
+            skip_spaces(p);
+            if (p->str[p->index] != ')') goto done;
+            p->index++; // skip ')'
+            depth--;
+            break;
         }
-        
-        skip_spaces(str);
-        index++; // skip ')'
     }
-    
-    skip_spaces(str);
-    index++; // skip ')'
-    
-    return node;
+    ok = true;
+
+done:
+    free(frames);
+    return ok;
+}
+
+static TreeNode* run_parser(TreeParser* p, int* error_offset) {
+    TreeStats* stats = p->stats;
+    stats->height = -1;
+    stats->nodes = 0;
+    stats->terminal_nodes = 0;
+
+    TreeNode* root = NULL;
+    bool ok = parse_tree(p, &root);
+    if (ok) {
+        skip_spaces(p);
+        ok = p->str[p->index] == '\0';
+    }
+
+    if (!ok) {
+        if (p->arena) tree_arena_reset(p->arena);
+        else free_tree(root);
+        stats->height = -1;
+        stats->nodes = 0;
+        stats->terminal_nodes = 0;
+        if (error_offset) *error_offset = p->index;
+        return NULL;
+    }
+
+    if (error_offset) *error_offset = -1;
+    return root;
+}
+
+TreeNode* parse_build_analyze(const char* tree_string, TreeStats* stats, int* error_offset) {
+    TreeStats local;
+    TreeParser p = { tree_string, 0, stats ? stats : &local, NULL };
+    return run_parser(&p, error_offset);
+}
+
+TreeNode* parse_build_analyze_arena(const char* tree_string, TreeArena* arena,
+                                    TreeStats* stats, int* error_offset) {
+    // Every node name is a run of letters with at least one separator
+    // before it, so a string of length n has at most (n + 1) / 2 nodes and
+    // n label bytes. Reserving that up front keeps the tree in one block.
+    size_t len = strlen(tree_string);
+    size_t max_nodes = (len + 1) / 2;
+    size_t bound = max_nodes * (sizeof(TreeNode) + 1 + TREE_ARENA_ALIGN) + len;
+
+    tree_arena_reset(arena);
+    if (!tree_arena_reserve(arena, bound)) {
+        if (error_offset) *error_offset = 0;
+        return NULL;
+    }
+
+    TreeStats local;
+    TreeParser p = { tree_string, 0, stats ? stats : &local, arena };
+    return run_parser(&p, error_offset);
 }
 
 TreeNode* parse_and_build_tree(const char* tree_string) {
-    index = 0;
-    return build_node(tree_string);
+    return parse_build_analyze(tree_string, NULL, NULL);
+}
+
+// Morris in-order walk: the right pointer of each left subtree's rightmost
+// node is threaded back to its ancestor and restored on the way out, so all
+// three statistics come from one pass with O(1) extra memory. The depth of
+// that ancestor is recovered from the number of steps to its predecessor.
+void analyze_tree(TreeNode* root, TreeStats* stats) {
+    stats->height = -1;
+    stats->nodes = 0;
+    stats->terminal_nodes = 0;
+
+    TreeNode* current = root;
+    int depth = 0;
+    while (current != NULL) {
+        if (current->left == NULL) {
+            stats->nodes++;
+            if (depth > stats->height) stats->height = depth;
+            // A NULL right here is real; a leaf whose right is a thread is
+            // counted when the thread is removed below
+            if (current->right == NULL) stats->terminal_nodes++;
+            current = current->right;
+            depth++;
+            continue;
+        }
+
+        TreeNode* pre = current->left;
+        int steps = 1;
+        while (pre->right != NULL && pre->right != current) {
+            pre = pre->right;
+            steps++;
+        }
+
+        if (pre->right == NULL) {
+            pre->right = current;
+            current = current->left;
+            depth++;
+        } else {
+            // Back from the left subtree through the thread
+            pre->right = NULL;
+            if (pre->left == NULL) stats->terminal_nodes++;
+            depth -= steps + 1;
+
+            stats->nodes++;
+            if (depth > stats->height) stats->height = depth;
+            current = current->right;
+            depth++;
+        }
+    }
 }
 
 int calculate_height(TreeNode* root) {
-    if (root == NULL) return -1;
-    if (root->left == NULL && root->right == NULL) return 0;
-    
-    int left_height = calculate_height(root->left);
-    int right_height = calculate_height(root->right);
-    
-    return 1 + (left_height > right_height ? left_height : right_height);
+    TreeStats stats;
+    analyze_tree(root, &stats);
+    return stats.height;
 }
 
 int count_nodes(TreeNode* root) {
-    if (root == NULL) return 0;
-    return 1 + count_nodes(root->left) + count_nodes(root->right);
+    TreeStats stats;
+    analyze_tree(root, &stats);
+    return stats.nodes;
 }
 
 int count_terminal_nodes(TreeNode* root) {
-    if (root == NULL) return 0;
-    if (root->left == NULL && root->right == NULL) return 1;
-    return count_terminal_nodes(root->left) + count_terminal_nodes(root->right);
+    TreeStats stats;
+    analyze_tree(root, &stats);
+    return stats.terminal_nodes;
 }
 
+// Rotate left children up until the root has none, then free it and
+// continue with its right subtree. No recursion and no extra memory.
 void free_tree(TreeNode* root) {
-    if (root) {
-        free_tree(root->left);
-        free_tree(root->right);
-        free(root);
+    while (root) {
+        if (root->left) {
+            TreeNode* left = root->left;
+            root->left = left->right;
+            left->right = root;
+            root = left;
+        } else {
+            TreeNode* right = root->right;
+            free(root);
+            root = right;
+        }
     }
-}
\ No newline at end of file
+}
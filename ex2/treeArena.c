@@ -0,0 +1,40 @@
+#include "treeFunction.h"
+#include <stdlib.h>
+
+void tree_arena_init(TreeArena* arena) {
+    arena->base = NULL;
+    arena->used = 0;
+    arena->capacity = 0;
+}
+
+bool tree_arena_reserve(TreeArena* arena, size_t bytes) {
+    if (arena->used != 0) return false;  // live nodes would move
+    if (bytes <= arena->capacity) return true;
+
+    // Grow geometrically so a stream of similar trees settles on one block
+    size_t new_capacity = arena->capacity ? arena->capacity : 4096;
+    while (new_capacity < bytes) new_capacity *= 2;
+
+    char* block = (char*)malloc(new_capacity);
+    if (!block) return false;
+    free(arena->base);
+    arena->base = block;
+    arena->capacity = new_capacity;
+    return true;
+}
+
+void* tree_arena_alloc(TreeArena* arena, size_t size) {
+    size_t start = (arena->used + TREE_ARENA_ALIGN - 1) & ~(size_t)(TREE_ARENA_ALIGN - 1);
+    if (start > arena->capacity || size > arena->capacity - start) return NULL;
+    arena->used = start + size;
+    return arena->base + start;
+}
+
+void tree_arena_reset(TreeArena* arena) {
+    arena->used = 0;
+}
+
+void tree_arena_free(TreeArena* arena) {
+    free(arena->base);
+    tree_arena_init(arena);
+}
@@ -0,0 +1,174 @@
+#include "treeFunction.h"
+#include <stdlib.h>
+#include <string.h>
+
+// ==================== Symbol table ====================
+
+void symbol_table_init(SymbolTable* table) {
+    table->bytes = NULL;
+    table->bytes_used = 0;
+    table->bytes_capacity = 0;
+    table->offsets = NULL;
+    table->count = 0;
+    table->capacity = 0;
+    table->buckets = NULL;
+    table->bucket_count = 0;
+}
+
+void symbol_table_free(SymbolTable* table) {
+    free(table->bytes);
+    free(table->offsets);
+    free(table->buckets);
+    symbol_table_init(table);
+}
+
+// FNV-1a
+static unsigned int hash_label(const char* name, int len) {
+    unsigned int h = 2166136261u;
+    for (int i = 0; i < len; i++) {
+        h ^= (unsigned char)name[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static bool rehash(SymbolTable* table, int new_bucket_count) {
+    int* buckets = (int*)calloc(new_bucket_count, sizeof(int));
+    if (!buckets) return false;
+
+    unsigned int mask = (unsigned int)new_bucket_count - 1;
+    for (int id = 0; id < table->count; id++) {
+        const char* name = table->bytes + table->offsets[id];
+        unsigned int slot = hash_label(name, (int)strlen(name)) & mask;
+        while (buckets[slot] != 0) slot = (slot + 1) & mask;
+        buckets[slot] = id + 1;
+    }
+
+    free(table->buckets);
+    table->buckets = buckets;
+    table->bucket_count = new_bucket_count;
+    return true;
+}
+
+int symbol_intern(SymbolTable* table, const char* name, int len) {
+    // Keep the load factor at or below 1/2
+    if ((table->count + 1) * 2 > table->bucket_count) {
+        if (!rehash(table, table->bucket_count ? table->bucket_count * 2 : 64)) return -1;
+    }
+
+    unsigned int mask = (unsigned int)table->bucket_count - 1;
+    unsigned int slot = hash_label(name, len) & mask;
+    while (table->buckets[slot] != 0) {
+        int id = table->buckets[slot] - 1;
+        const char* existing = table->bytes + table->offsets[id];
+        if (strncmp(existing, name, len) == 0 && existing[len] == '\0') return id;
+        slot = (slot + 1) & mask;
+    }
+
+    // New symbol: append its bytes and offset
+    if (table->bytes_used + len + 1 > table->bytes_capacity) {
+        size_t new_capacity = table->bytes_capacity ? table->bytes_capacity * 2 : 256;
+        while (new_capacity < table->bytes_used + len + 1) new_capacity *= 2;
+        char* temp = (char*)realloc(table->bytes, new_capacity);
+        if (!temp) return -1;
+        table->bytes = temp;
+        table->bytes_capacity = new_capacity;
+    }
+    if (table->count == table->capacity) {
+        int new_capacity = table->capacity ? table->capacity * 2 : 32;
+        int* temp = (int*)realloc(table->offsets, sizeof(int) * new_capacity);
+        if (!temp) return -1;
+        table->offsets = temp;
+        table->capacity = new_capacity;
+    }
+
+    int id = table->count++;
+    table->offsets[id] = (int)table->bytes_used;
+    memcpy(table->bytes + table->bytes_used, name, len);
+    table->bytes[table->bytes_used + len] = '\0';
+    table->bytes_used += len + 1;
+    table->buckets[slot] = id + 1;
+    return id;
+}
+
+const char* symbol_name(const SymbolTable* table, int id) {
+    if (id < 0 || id >= table->count) return NULL;
+    return table->bytes + table->offsets[id];
+}
+
+// ==================== Compact tree ====================
+
+// Copy the pointer tree into pre-order slots. A node gets its slot when it
+// is popped, so slots follow the visiting order; each stack entry carries
+// the parent's slot and side so the parent's link can be patched then.
+typedef struct {
+    TreeNode* node;
+    int parent;  // parent's slot, -1 for the root
+    bool right;  // which link of the parent points here
+} FlattenEntry;
+
+static bool flatten(TreeNode* root, CompactTree* tree) {
+    FlattenEntry* stack = (FlattenEntry*)malloc(sizeof(FlattenEntry) * (tree->count > 0 ? tree->count : 1));
+    if (!stack) return false;
+
+    int top = 0;
+    int next = 0;
+    stack[top++] = (FlattenEntry){ root, -1, false };
+
+    while (top > 0) {
+        FlattenEntry e = stack[--top];
+        int index = next++;
+        CompactNode* out = &tree->nodes[index];
+
+        out->label = symbol_intern(tree->symbols, e.node->data, (int)strlen(e.node->data));
+        if (out->label < 0) {
+            free(stack);
+            return false;
+        }
+        out->left = -1;
+        out->right = -1;
+        if (e.parent >= 0) {
+            if (e.right) tree->nodes[e.parent].right = index;
+            else tree->nodes[e.parent].left = index;
+        }
+
+        // Right is pushed first so the left subtree is popped first
+        if (e.node->right) stack[top++] = (FlattenEntry){ e.node->right, index, true };
+        if (e.node->left) stack[top++] = (FlattenEntry){ e.node->left, index, false };
+    }
+
+    free(stack);
+    return true;
+}
+
+bool compact_tree_build(const char* tree_string, SymbolTable* symbols, TreeArena* scratch,
+                        CompactTree* tree, TreeStats* stats, int* error_offset) {
+    TreeStats local;
+    if (!stats) stats = &local;
+
+    tree->nodes = NULL;
+    tree->count = 0;
+    tree->symbols = symbols;
+
+    // Reuse the validating parser; the arena makes the temporary tree cheap
+    TreeNode* root = parse_build_analyze_arena(tree_string, scratch, stats, error_offset);
+    if (!root) return false;
+
+    tree->nodes = (CompactNode*)malloc(sizeof(CompactNode) * stats->nodes);
+    tree->count = stats->nodes;
+    bool ok = tree->nodes != NULL && flatten(root, tree);
+
+    tree_arena_reset(scratch);
+    if (!ok) {
+        compact_tree_free(tree);
+        if (error_offset) *error_offset = 0;
+        return false;
+    }
+    return true;
+}
+
+void compact_tree_free(CompactTree* tree) {
+    free(tree->nodes);
+    tree->nodes = NULL;
+    tree->count = 0;
+}
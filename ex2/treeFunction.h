@@ -1,15 +1,89 @@
 #pragma once
 #include <stdbool.h>
+#include <stddef.h>
 
 typedef struct TreeNode {
-    char data[100];  // Node name
+    char* data;  // Node name, stored in the same block as the node
     struct TreeNode* left;
     struct TreeNode* right;
 } TreeNode;
 
+typedef struct {
+    int height;          // -1 for an empty tree
+    int nodes;
+    int terminal_nodes;
+} TreeStats;
+
+// Bump allocator holding one whole tree in a single block. Trees built in
+// an arena are released with tree_arena_reset/tree_arena_free, never with
+// free_tree.
+#define TREE_ARENA_ALIGN 8
+
+typedef struct {
+    char* base;
+    size_t used;
+    size_t capacity;
+} TreeArena;
+
+void tree_arena_init(TreeArena* arena);
+bool tree_arena_reserve(TreeArena* arena, size_t bytes);  // only on an empty arena
+void* tree_arena_alloc(TreeArena* arena, size_t size);     // NULL when the block is full
+void tree_arena_reset(TreeArena* arena);                   // O(1), keeps the block
+void tree_arena_free(TreeArena* arena);
+
+// Interned node labels. One table can be shared by many trees, so each
+// distinct label is stored once no matter how often it appears.
+typedef struct {
+    char* bytes;        // NUL-terminated labels, back to back
+    size_t bytes_used;
+    size_t bytes_capacity;
+    int* offsets;       // symbol id -> offset in bytes
+    int count;
+    int capacity;
+    int* buckets;       // open addressing, symbol id + 1 (0 = empty)
+    int bucket_count;
+} SymbolTable;
+
+// 12-byte node: label is a symbol id, children are node indices (-1 = none)
+typedef struct {
+    int label;
+    int left;
+    int right;
+} CompactNode;
+
+typedef struct {
+    CompactNode* nodes;  // pre-order, root at index 0
+    int count;
+    SymbolTable* symbols;
+} CompactTree;
+
+void symbol_table_init(SymbolTable* table);
+void symbol_table_free(SymbolTable* table);
+int symbol_intern(SymbolTable* table, const char* name, int len);  // -1 if out of memory
+const char* symbol_name(const SymbolTable* table, int id);  // valid until the next intern
+
+// Build a compact tree whose labels are interned into symbols. scratch is
+// a reusable arena for the intermediate pointer tree. Returns false (and
+// sets *error_offset) on an invalid string.
+bool compact_tree_build(const char* tree_string, SymbolTable* symbols, TreeArena* scratch,
+                        CompactTree* tree, TreeStats* stats, int* error_offset);
+void compact_tree_free(CompactTree* tree);
+
 bool is_valid_binary_tree(const char* tree_string);
 
 TreeNode* parse_and_build_tree(const char* tree_string);
+
+// Validate, build and measure in one left-to-right pass. On an invalid
+// string returns NULL and sets *error_offset to the offending character;
+// otherwise *error_offset is -1. stats and error_offset may be NULL.
+TreeNode* parse_build_analyze(const char* tree_string, TreeStats* stats, int* error_offset);
+
+// Same, but every node and label goes into arena (which is reset first)
+TreeNode* parse_build_analyze_arena(const char* tree_string, TreeArena* arena,
+                                    TreeStats* stats, int* error_offset);
+
+// Height, node and terminal-node counts in one walk
+void analyze_tree(TreeNode* root, TreeStats* stats);
 int calculate_height(TreeNode* root);
 int count_nodes(TreeNode* root);
 int count_terminal_nodes(TreeNode* root);
@@ -0,0 +1,182 @@
+#include "treeStream.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define STREAM_CHUNK 4096
+
+enum { KIND_PAREN, KIND_BARE };
+
+enum {
+    ST_NAME_START,  // expect a name
+    ST_AFTER_NAME,  // expect '(' children, or the end of this node
+    ST_LIST,        // inside a children list
+    ST_AFTER_LIST   // paren node: expect its closing ')'
+};
+
+void tree_stream_init(TreeStream* s) {
+    s->frames = NULL;
+    s->capacity = 0;
+    tree_stream_reset(s);
+}
+
+void tree_stream_free(TreeStream* s) {
+    free(s->frames);
+    s->frames = NULL;
+    s->capacity = 0;
+}
+
+void tree_stream_reset(TreeStream* s) {
+    s->depth = 0;
+    s->root_done = false;
+    s->failed = false;
+    tree_scan_init(&s->scan);
+    s->length = 0;
+    s->first = '\0';
+    s->last = '\0';
+    s->height = -1;
+    s->nodes = 0;
+    s->leaves = 0;
+}
+
+static bool push_frame(TreeStream* s, unsigned char kind, unsigned char state) {
+    if (s->depth == s->capacity) {
+        int new_capacity = s->capacity ? s->capacity * 2 : 64;
+        TreeStreamFrame* temp = (TreeStreamFrame*)realloc(s->frames, sizeof(TreeStreamFrame) * new_capacity);
+        if (!temp) {
+            s->failed = true;
+            return false;
+        }
+        s->frames = temp;
+        s->capacity = new_capacity;
+    }
+    TreeStreamFrame* f = &s->frames[s->depth++];
+    f->kind = kind;
+    f->state = state;
+    f->children = 0;
+
+    s->nodes++;
+    if (s->depth - 1 > s->height) s->height = s->depth - 1;
+    return true;
+}
+
+static void pop_frame(TreeStream* s, bool leaf) {
+    if (leaf) s->leaves++;
+    s->depth--;
+    if (s->depth == 0) s->root_done = true;
+}
+
+// Same grammar as is_valid_binary_tree, driven by the structural positions
+// from tree_scan: c is '(' , ')' or the first letter of a name. Spaces and
+// the rest of each name are never seen here; two names in a row can only
+// come from a separator between them, which the grammar rejects just as the
+// recursive parser does.
+static void step(TreeStream* s, char c) {
+    bool name = c != '(' && c != ')';
+
+    for (;;) {
+        if (s->depth == 0) {
+            if (s->root_done || c != '(') {
+                s->failed = true;
+                return;
+            }
+            push_frame(s, KIND_PAREN, ST_NAME_START);
+            return;
+        }
+
+        TreeStreamFrame* f = &s->frames[s->depth - 1];
+        switch (f->state) {
+        case ST_NAME_START:
+            if (!name) s->failed = true;
+            else f->state = ST_AFTER_NAME;
+            return;
+
+        case ST_AFTER_NAME:
+            if (c == '(') {
+                f->state = ST_LIST;
+                return;
+            }
+            if (f->kind == KIND_PAREN) {
+                if (c == ')') pop_frame(s, true);
+                else s->failed = true;
+                return;
+            }
+            // Bare leaf ends here; the parent list sees this character
+            pop_frame(s, true);
+            continue;
+
+        case ST_LIST:
+            if (c == ')') {
+                if (f->children == 0) s->failed = true; // Empty children list not allowed
+                else if (f->kind == KIND_PAREN) f->state = ST_AFTER_LIST;
+                else pop_frame(s, false);
+                return;
+            }
+            if (++f->children > 2) { // Binary tree: max 2 children
+                s->failed = true;
+                return;
+            }
+            if (c == '(') push_frame(s, KIND_PAREN, ST_NAME_START);
+            else push_frame(s, KIND_BARE, ST_AFTER_NAME);
+            return;
+
+        case ST_AFTER_LIST:
+            if (c == ')') pop_frame(s, false);
+            else s->failed = true;
+            return;
+        }
+    }
+}
+
+void tree_stream_feed(TreeStream* s, const char* buf, size_t len) {
+    if (len == 0) return;
+
+    for (size_t i = 0; i < len && s->length + (long long)i < 4; i++) {
+        s->head[s->length + i] = buf[i];
+    }
+    if (s->length == 0) s->first = buf[0];
+    s->last = buf[len - 1];
+    s->length += (long long)len;
+
+    unsigned short positions[TREE_SCAN_BLOCK];
+    for (size_t off = 0; off < len; off += TREE_SCAN_BLOCK) {
+        int block = len - off < TREE_SCAN_BLOCK ? (int)(len - off) : TREE_SCAN_BLOCK;
+        int n = tree_scan(&s->scan, buf + off, block, positions);
+
+        // An illegal byte already decides the result, so stop parsing
+        if (s->failed || s->scan.illegal) continue;
+        for (int k = 0; k < n && !s->failed; k++) {
+            step(s, buf[off + positions[k]]);
+        }
+    }
+}
+
+TreeStreamResult tree_stream_finish(TreeStream* s) {
+    if (s->length == 0 || s->scan.illegal ||
+        s->first != '(' || s->last != ')' ||
+        s->scan.open_count != s->scan.close_count) {
+        return TREE_STREAM_ERROR;
+    }
+    if (s->failed || !s->root_done || s->depth != 0) return TREE_STREAM_FALSE;
+    return TREE_STREAM_TRUE;
+}
+
+bool tree_stream_read_record(TreeStream* s, FILE* fp) {
+    char chunk[STREAM_CHUNK];
+    bool got_any = false;
+
+    tree_stream_reset(s);
+    while (fgets(chunk, sizeof(chunk), fp)) {
+        got_any = true;
+        size_t len = strlen(chunk);
+        bool end_of_line = len > 0 && chunk[len - 1] == '\n';
+        if (end_of_line) len--;
+
+        tree_stream_feed(s, chunk, len);
+        if (end_of_line) break;
+    }
+    return got_any;
+}
+
+bool tree_stream_is_quit(const TreeStream* s) {
+    return s->length == 4 && memcmp(s->head, "quit", 4) == 0;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "treeScan.h"
+
+// Incremental validator for newline-separated tree records. Input is fed in
+// chunks of any size, so a record never has to fit in a buffer; memory grows
+// only with the nesting depth of the tree.
+
+typedef enum {
+    TREE_STREAM_ERROR,  // malformed input (what has_input_errors used to catch)
+    TREE_STREAM_FALSE,  // well-formed input but not a binary tree
+    TREE_STREAM_TRUE
+} TreeStreamResult;
+
+typedef struct {
+    unsigned char kind;      // paren node "(A ...)" or bare child token "A (...)"
+    unsigned char state;
+    unsigned char children;
+} TreeStreamFrame;
+
+typedef struct {
+    TreeStreamFrame* frames;
+    int depth;
+    int capacity;
+    bool root_done;
+    bool failed;
+
+    // Per-record input checks
+    TreeScanState scan;
+    long long length;
+    char first;
+    char last;
+    char head[4];
+
+    // Statistics of the record, valid when the result is TREE_STREAM_TRUE
+    int height;
+    long long nodes;
+    long long leaves;
+} TreeStream;
+
+void tree_stream_init(TreeStream* s);
+void tree_stream_free(TreeStream* s);
+void tree_stream_reset(TreeStream* s);
+
+// Feed part of the current record (must not contain the newline)
+void tree_stream_feed(TreeStream* s, const char* buf, size_t len);
+TreeStreamResult tree_stream_finish(TreeStream* s);
+
+// Reset s and feed it the next record from fp. Returns false at end of input.
+bool tree_stream_read_record(TreeStream* s, FILE* fp);
+bool tree_stream_is_quit(const TreeStream* s);
@@ -3,12 +3,42 @@
 #include <stdlib.h>
 #include <string.h>
 
+// Read one line of any length; the caller frees the result
+static char *readLine(FILE *fp)
+{
+    size_t capacity = MAX_INPUT_SIZE;
+    size_t length = 0;
+    char *line = (char *)malloc(capacity);
+    if (!line)
+        return NULL;
+
+    while (fgets(line + length, (int)(capacity - length), fp))
+    {
+        length += strlen(line + length);
+        if (length > 0 && line[length - 1] == '\n')
+            break;
+
+        char *temp = (char *)realloc(line, capacity * 2);
+        if (!temp)
+            break;
+        line = temp;
+        capacity *= 2;
+    }
+
+    if (length == 0)
+    {
+        free(line);
+        return NULL;
+    }
+    return line;
+}
+
 int main()
 {
-    char input_string[MAX_INPUT_SIZE];
+    char *input_string = readLine(stdin);
     int root_index = 1;
 
-    if (fgets(input_string, MAX_INPUT_SIZE, stdin) == NULL)
+    if (input_string == NULL)
     {
         fprintf(stderr, "Error reading input.\n");
         return 1;
@@ -16,12 +46,12 @@ int main()
 
     input_string[strcspn(input_string, "\n")] = 0;
 
-    memset(tree, 0, sizeof(tree));
     parseTree(input_string);
 
     if (!isValidNode(root_index))
     {
         fprintf(stderr, "Error: Failed to parse the tree input or root is invalid.\n");
+        free(input_string);
         return 1;
     }
 
@@ -30,9 +60,9 @@ int main()
     printTreeArray(root_index);
 
     printf("\nFinal Output (Iterative Traversal):\n");
-    preorder_iterative(root_index);
-    inorder_iterative(root_index);
-    postorder_iterative(root_index);
+    print_traversals(root_index);
 
+    freeTree();
+    free(input_string);
     return 0;
 }
\ No newline at end of file
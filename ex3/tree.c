@@ -3,19 +3,41 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <limits.h>
+#include <stdatomic.h>
 
-TreeNode tree[MAX_NODES];
+TreeNode *tree = NULL;
 int node_count = 0;
+static int tree_capacity = 0;
+
+void initialize(Stack *s)
+{
+    s->items = NULL;
+    s->top = -1;
+    s->capacity = 0;
+}
+
+void freeStack(Stack *s)
+{
+    free(s->items);
+    initialize(s);
+}
 
-void initialize(Stack *s) { s->top = -1; }
 int isEmpty(Stack *s) { return s->top == -1; }
 
 void push(Stack *s, int value)
 {
-    if (s->top == STACK_SIZE - 1)
+    if (s->top == s->capacity - 1)
     {
-        fprintf(stderr, "Error: Stack overflow (Stack size %d)\n", STACK_SIZE);
-        exit(EXIT_FAILURE);
+        int new_capacity = s->capacity ? s->capacity * 2 : STACK_SIZE;
+        int *temp = (int *)realloc(s->items, sizeof(int) * new_capacity);
+        if (!temp)
+        {
+            fprintf(stderr, "Error: Stack overflow (Stack size %d)\n", s->capacity);
+            exit(EXIT_FAILURE);
+        }
+        s->items = temp;
+        s->capacity = new_capacity;
     }
     s->items[++(s->top)] = value;
 }
@@ -29,7 +51,45 @@ int pop(Stack *s)
 
 int isValidNode(int index)
 {
-    return index >= 1 && index < MAX_NODES && tree[index].data != '\0';
+    return index >= 1 && index <= node_count && tree[index].data != '\0';
+}
+
+void resetTree(void)
+{
+    node_count = 0;
+}
+
+void freeTree(void)
+{
+    free(tree);
+    tree = NULL;
+    tree_capacity = 0;
+    node_count = 0;
+}
+
+// Append a node and return its slot. Slot 0 stays unused as "no node".
+int newNode(char data, unsigned long long heap_index)
+{
+    if (node_count + 1 >= tree_capacity)
+    {
+        int new_capacity = tree_capacity ? tree_capacity * 2 : INITIAL_NODES;
+        TreeNode *temp = (TreeNode *)realloc(tree, sizeof(TreeNode) * new_capacity);
+        if (!temp)
+        {
+            fprintf(stderr, "Error: Out of memory for %d nodes.\n", new_capacity);
+            exit(EXIT_FAILURE);
+        }
+        tree = temp;
+        tree_capacity = new_capacity;
+        memset(&tree[0], 0, sizeof(TreeNode));
+    }
+
+    int index = ++node_count;
+    tree[index].data = data;
+    tree[index].left = 0;
+    tree[index].right = 0;
+    tree[index].heap_index = heap_index;
+    return index;
 }
 
 void skipWhitespace(const char *str, int *i)
@@ -40,9 +100,12 @@ void skipWhitespace(const char *str, int *i)
     }
 }
 
-int getNextIndex(int parent_index, int side)
+unsigned long long getNextIndex(unsigned long long parent_heap_index, int side)
 {
-    return (side == 1) ? (2 * parent_index) : (2 * parent_index + 1);
+    // 0 marks a node too deep for the implicit numbering
+    if (parent_heap_index == 0 || parent_heap_index > (ULLONG_MAX - 1) / 2)
+        return 0;
+    return (side == 1) ? (2 * parent_heap_index) : (2 * parent_heap_index + 1);
 }
 
 int parseTree(const char *input_string)
@@ -59,8 +122,8 @@ int parseTree(const char *input_string)
 
     if (isalpha(input_string[i]))
     {
-        int root_index = 1;
-        tree[root_index].data = input_string[i];
+        resetTree();
+        int root_index = newNode(input_string[i], 1);
 
         i++;
         skipWhitespace(input_string, &i);
@@ -77,170 +140,303 @@ int parseTree(const char *input_string)
             fprintf(stderr, "Error: Missing final closing parenthesis ')' at index %d.\n", i);
         }
 
-        if (node_count == 0)
-            node_count = 1;
-
         return root_index;
     }
     fprintf(stderr, "Error: Root node data expected.\n");
     return -1;
 }
 
-int parseNode(const char *str, int *i, int parent_index, int side)
+// Parse a children list up to (not including) its closing ')'. Lists that
+// are still open sit on an explicit stack instead of the C stack, so the
+// depth of the tree is limited only by memory. A node's children so far are
+// read back from its left/right links.
+void parseChildren(const char *str, int *i, int current_node_index)
 {
-    skipWhitespace(str, i);
-    if (str[*i] == '\0' || str[*i] == ')')
-        return 0;
+    Stack open;
+    initialize(&open);
+    push(&open, current_node_index);
 
-    int current_node_index = getNextIndex(parent_index, side);
-    if (current_node_index >= MAX_NODES)
+    while (!isEmpty(&open))
     {
-        fprintf(stderr, "Error: Max nodes exceeded.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    tree[current_node_index].data = str[*i];
+        int parent = open.items[open.top];
+        int children = tree[parent].left ? (tree[parent].right ? 2 : 1) : 0;
 
-    if (current_node_index > node_count)
-        node_count = current_node_index;
+        skipWhitespace(str, i);
+        if (children == 2 || str[*i] == ')' || str[*i] == '\0')
+        {
+            pop(&open);
+            // The outermost list is closed by the caller
+            if (isEmpty(&open))
+                break;
+            if (str[*i] != ')')
+            {
+                fprintf(stderr, "Error: Missing closing parenthesis ')' at index %d.\n", *i);
+            }
+            if (str[*i] != '\0')
+                (*i)++;
+            continue;
+        }
 
-    (*i)++;
-    skipWhitespace(str, i);
+        // newNode may grow (move) the array, so link the child afterwards
+        int side = children + 1;
+        int child = newNode(str[*i], getNextIndex(tree[parent].heap_index, side));
+        if (side == 1)
+            tree[parent].left = child;
+        else
+            tree[parent].right = child;
 
-    if (str[*i] == '(')
-    {
         (*i)++;
-        parseChildren(str, i, current_node_index);
         skipWhitespace(str, i);
-        if (str[*i] != ')')
+        if (str[*i] == '(')
         {
-            fprintf(stderr, "Error: Missing closing parenthesis ')' at index %d.\n", *i);
+            (*i)++;
+            push(&open, child);
         }
-        (*i)++;
     }
-    return current_node_index;
+    freeStack(&open);
 }
 
-void parseChildren(const char *str, int *i, int current_node_index)
+// isValidNode for an arbitrary node array
+static int validIn(const TreeNode *nodes, int count, int index)
 {
-    skipWhitespace(str, i);
-    if (str[*i] == ')' || str[*i] == '\0')
-        return;
-
-    tree[current_node_index].left = parseNode(str, i, current_node_index, 1);
-
-    skipWhitespace(str, i);
-    if (str[*i] == ')' || str[*i] == '\0')
-        return;
-
-    tree[current_node_index].right = parseNode(str, i, current_node_index, 2);
+    return index >= 1 && index <= count && nodes[index].data != '\0';
 }
 
-void preorder_iterative(int root_index)
+// One walk that reports every node three times: on the way down (pre),
+// between its subtrees (in) and on the way up (post). The stack only holds
+// the current path, and prev tells which direction we arrived from. Pass a
+// scratch stack to reuse its memory across calls; NULL uses a temporary one.
+// Works on any node array, so snapshot readers never touch the globals.
+static void traverseNodes(const TreeNode *nodes, int count, int root_index,
+                          NodeVisitor pre, NodeVisitor in, NodeVisitor post,
+                          void *ctx, Stack *scratch)
 {
-    if (!isValidNode(root_index))
+    if (!validIn(nodes, count, root_index))
         return;
-    Stack s;
-    initialize(&s);
-    push(&s, root_index);
-    printf("pre-order: ");
-    while (!isEmpty(&s))
-    {
-        int current_index = pop(&s);
-        printf("%c ", tree[current_index].data);
-
-        if (tree[current_index].right != 0 && isValidNode(tree[current_index].right))
-        {
-            push(&s, tree[current_index].right);
-        }
-
-        if (tree[current_index].left != 0 && isValidNode(tree[current_index].left))
-        {
-            push(&s, tree[current_index].left);
-        }
-    }
-    printf("\n");
-}
-
-void inorder_iterative(int root_index)
-{
-    Stack s;
-    initialize(&s);
-    int current_index = root_index;
 
-    printf("in-order: ");
+    Stack local;
+    Stack *s = scratch ? scratch : &local;
+    if (!scratch)
+        initialize(&local);
+    s->top = -1;
 
-    while (!isEmpty(&s) || current_index != -1)
+    push(s, root_index);
+    int prev = 0;
+    while (!isEmpty(s))
     {
+        int current_index = s->items[s->top];
+        int left = validIn(nodes, count, nodes[current_index].left) ? nodes[current_index].left : 0;
+        int right = validIn(nodes, count, nodes[current_index].right) ? nodes[current_index].right : 0;
 
-        while (current_index != -1 && isValidNode(current_index))
+        if (prev == 0 || nodes[prev].left == current_index || nodes[prev].right == current_index)
         {
-            push(&s, current_index);
-
-            if (tree[current_index].left != 0)
+            // Arrived from the parent
+            if (pre)
+                pre(current_index, ctx);
+            if (left)
             {
-                current_index = tree[current_index].left;
+                push(s, left);
             }
             else
             {
-                current_index = -1;
+                if (in)
+                    in(current_index, ctx);
+                if (right)
+                {
+                    push(s, right);
+                }
+                else
+                {
+                    if (post)
+                        post(current_index, ctx);
+                    pop(s);
+                }
             }
         }
-
-        if (!isEmpty(&s))
+        else if (prev == left)
         {
-            current_index = pop(&s);
-
-            if (current_index == -1)
-                break;
-
-            printf("%c ", tree[current_index].data);
-
-            if (tree[current_index].right != 0)
+            // Back from the left subtree
+            if (in)
+                in(current_index, ctx);
+            if (right)
             {
-                current_index = tree[current_index].right;
+                push(s, right);
             }
             else
             {
-                current_index = -1;
+                if (post)
+                    post(current_index, ctx);
+                pop(s);
             }
         }
         else
         {
-            break;
+            // Back from the right subtree
+            if (post)
+                post(current_index, ctx);
+            pop(s);
         }
+        prev = current_index;
     }
-    printf("\n");
+
+    if (!scratch)
+        freeStack(&local);
 }
 
-void postorder_iterative(int root_index)
+void traverse(int root_index, NodeVisitor pre, NodeVisitor in, NodeVisitor post,
+              void *ctx, Stack *scratch)
 {
-    if (!isValidNode(root_index))
-        return;
-    Stack s1, s2;
-    initialize(&s1);
-    initialize(&s2);
-    push(&s1, root_index);
-    while (!isEmpty(&s1))
-    {
-        int current_index = pop(&s1);
-        push(&s2, current_index);
+    traverseNodes(tree, node_count, root_index, pre, in, post, ctx, scratch);
+}
 
-        if (tree[current_index].left != 0 && isValidNode(tree[current_index].left))
-        {
-            push(&s1, tree[current_index].left);
-        }
-        if (tree[current_index].right != 0 && isValidNode(tree[current_index].right))
+typedef struct
+{
+    const TreeNode *nodes;
+    char *order[3];
+    int count[3];
+} Collector;
+
+static void collectPre(int index, void *ctx)
+{
+    Collector *c = (Collector *)ctx;
+    if (c->order[0])
+        c->order[0][c->count[0]] = c->nodes[index].data;
+    c->count[0]++; // always counted: the return value of traversal_orders
+}
+
+static void collectIn(int index, void *ctx)
+{
+    Collector *c = (Collector *)ctx;
+    if (c->order[1])
+        c->order[1][c->count[1]++] = c->nodes[index].data;
+}
+
+static void collectPost(int index, void *ctx)
+{
+    Collector *c = (Collector *)ctx;
+    if (c->order[2])
+        c->order[2][c->count[2]++] = c->nodes[index].data;
+}
+
+static int collectOrders(const TreeNode *nodes, int count, int root_index,
+                         char *pre, char *in, char *post, Stack *scratch)
+{
+    Collector c = {nodes, {pre, in, post}, {0, 0, 0}};
+    traverseNodes(nodes, count, root_index, collectPre, in ? collectIn : NULL,
+                  post ? collectPost : NULL, &c, scratch);
+    return c.count[0];
+}
+
+int traversal_orders(int root_index, char *pre, char *in, char *post, Stack *scratch)
+{
+    return collectOrders(tree, node_count, root_index, pre, in, post, scratch);
+}
+
+int snapshot_traversal_orders(const TreeSnapshot *snap, char *pre, char *in, char *post, Stack *scratch)
+{
+    if (!snap)
+        return 0;
+    return collectOrders(snap->nodes, snap->node_count, snap->root_index, pre, in, post, scratch);
+}
+
+// Print "label: a b c \n" through a fixed buffer, one fwrite per 4 KB
+static void printSequence(const char *label, const char *seq, int n)
+{
+    char buf[4096];
+    int len = snprintf(buf, sizeof(buf), "%s: ", label);
+    for (int k = 0; k < n; k++)
+    {
+        if (len + 2 > (int)sizeof(buf))
         {
-            push(&s1, tree[current_index].right);
+            fwrite(buf, 1, len, stdout);
+            len = 0;
         }
+        buf[len++] = seq[k];
+        buf[len++] = ' ';
     }
-    printf("post-order: ");
-    while (!isEmpty(&s2))
+    if (len + 1 > (int)sizeof(buf))
     {
-        printf("%c ", tree[pop(&s2)].data);
+        fwrite(buf, 1, len, stdout);
+        len = 0;
     }
-    printf("\n");
+    buf[len++] = '\n';
+    fwrite(buf, 1, len, stdout);
+}
+
+static void printOrder(int root_index, int which, const char *label)
+{
+    char *seq = (char *)malloc(node_count > 0 ? node_count : 1);
+    if (!seq)
+        return;
+    char *orders[3] = {NULL, NULL, NULL};
+    orders[which] = seq;
+    int n = traversal_orders(root_index, orders[0], orders[1], orders[2], NULL);
+    printSequence(label, seq, n);
+    free(seq);
+}
+
+void preorder_iterative(int root_index)
+{
+    if (!isValidNode(root_index))
+        return;
+    printOrder(root_index, 0, "pre-order");
+}
+
+void inorder_iterative(int root_index)
+{
+    printOrder(root_index, 1, "in-order");
+}
+
+void postorder_iterative(int root_index)
+{
+    if (!isValidNode(root_index))
+        return;
+    printOrder(root_index, 2, "post-order");
+}
+
+// All three orders from a single walk
+void print_traversals(int root_index)
+{
+    if (!isValidNode(root_index))
+        return;
+
+    char *seq = (char *)malloc((size_t)3 * (node_count > 0 ? node_count : 1));
+    if (!seq)
+        return;
+    char *pre = seq;
+    char *in = seq + node_count;
+    char *post = seq + 2 * node_count;
+
+    int n = traversal_orders(root_index, pre, in, post, NULL);
+    printSequence("pre-order", pre, n);
+    printSequence("in-order", in, n);
+    printSequence("post-order", post, n);
+    free(seq);
+}
+
+static int compareHeapIndex(const void *a, const void *b)
+{
+    int slot_a = *(const int *)a;
+    int slot_b = *(const int *)b;
+    unsigned long long x = tree[slot_a].heap_index;
+    unsigned long long y = tree[slot_b].heap_index;
+
+    if (x != 0 && y != 0)
+        return (x > y) - (x < y);
+    // Unnumbered (too deep) nodes go last, in creation order
+    if (x == 0 && y == 0)
+        return slot_a - slot_b;
+    return x == 0 ? 1 : -1;
+}
+
+static void formatHeapIndex(int slot, char *buf, size_t size)
+{
+    if (slot == 0)
+        snprintf(buf, size, "0");
+    else if (tree[slot].heap_index == 0)
+        snprintf(buf, size, "-");
+    else
+        snprintf(buf, size, "%llu", tree[slot].heap_index);
 }
 
 void printTreeArray(int root_index)
@@ -249,12 +445,152 @@ void printTreeArray(int root_index)
     printf("| Index (i) | Data | Left Child (2i) | Right Child (2i+1) |\n");
     printf("|:---------:|:----:|:-----------------:|:-------------------:|\n");
 
-    for (int i = 0; i < MAX_NODES; i++)
+    // Rows in implicit-layout order, as if the tree were a flat array
+    int *order = (int *)malloc(sizeof(int) * (node_count > 0 ? node_count : 1));
+    if (!order)
+        return;
+    for (int i = 0; i < node_count; i++)
+        order[i] = i + 1;
+    qsort(order, node_count, sizeof(int), compareHeapIndex);
+
+    for (int k = 0; k < node_count; k++)
+    {
+        int i = order[k];
+        char index_buf[24], left_buf[24], right_buf[24];
+        formatHeapIndex(i, index_buf, sizeof(index_buf));
+        formatHeapIndex(tree[i].left, left_buf, sizeof(left_buf));
+        formatHeapIndex(tree[i].right, right_buf, sizeof(right_buf));
+        printf("| %9s | %4c | %17s | %19s |\n",
+               index_buf, tree[i].data, left_buf, right_buf);
+    }
+    free(order);
+}
+
+// ==================== Snapshots ====================
+// Readers announce the snapshot they use in a hazard slot; the writer only
+// frees a retired snapshot once no slot points at it. Readers never lock or
+// wait, they just retry if a new snapshot was published between reading
+// the pointer and announcing it.
+
+static _Atomic(TreeSnapshot *) current_snapshot = NULL;
+static _Atomic(TreeSnapshot *) hazards[MAX_READERS];
+static atomic_int reader_used[MAX_READERS];
+
+// Writer-side list of snapshots replaced but possibly still being read
+static TreeSnapshot **retired = NULL;
+static int retired_count = 0;
+static int retired_capacity = 0;
+
+int registerReader(void)
+{
+    for (int r = 0; r < MAX_READERS; r++)
+    {
+        int expected = 0;
+        if (atomic_compare_exchange_strong(&reader_used[r], &expected, 1))
+            return r;
+    }
+    return -1;
+}
+
+void unregisterReader(int reader)
+{
+    atomic_store(&hazards[reader], NULL);
+    atomic_store(&reader_used[reader], 0);
+}
+
+const TreeSnapshot *acquireSnapshot(int reader)
+{
+    TreeSnapshot *snap = atomic_load(&current_snapshot);
+    for (;;)
+    {
+        atomic_store(&hazards[reader], snap);
+        TreeSnapshot *again = atomic_load(&current_snapshot);
+        if (again == snap)
+            return snap;
+        snap = again;
+    }
+}
+
+void releaseSnapshot(int reader)
+{
+    atomic_store(&hazards[reader], NULL);
+}
+
+static int isHazard(const TreeSnapshot *snap)
+{
+    for (int r = 0; r < MAX_READERS; r++)
+    {
+        if (atomic_load(&hazards[r]) == snap)
+            return 1;
+    }
+    return 0;
+}
+
+static void freeSnapshot(TreeSnapshot *snap)
+{
+    free(snap->nodes);
+    free(snap);
+}
+
+// Free every retired snapshot that no reader holds any more
+static void reclaimSnapshots(void)
+{
+    int kept = 0;
+    for (int k = 0; k < retired_count; k++)
+    {
+        if (isHazard(retired[k]))
+            retired[kept++] = retired[k];
+        else
+            freeSnapshot(retired[k]);
+    }
+    retired_count = kept;
+}
+
+int publishSnapshot(int root_index)
+{
+    TreeSnapshot *snap = (TreeSnapshot *)malloc(sizeof(TreeSnapshot));
+    if (!snap)
+        return 0;
+
+    // The snapshot takes over the array; the next parseTree starts afresh
+    snap->nodes = tree;
+    snap->node_count = node_count;
+    snap->root_index = root_index;
+    tree = NULL;
+    tree_capacity = 0;
+    node_count = 0;
+
+    TreeSnapshot *old = atomic_exchange(&current_snapshot, snap);
+    if (old)
     {
-        if (tree[i].data != '\0')
+        if (retired_count == retired_capacity)
         {
-            printf("| %9d | %4c | %17d | %19d |\n",
-                   i, tree[i].data, tree[i].left, tree[i].right);
+            int new_capacity = retired_capacity ? retired_capacity * 2 : 8;
+            TreeSnapshot **temp = (TreeSnapshot **)realloc(retired, sizeof(TreeSnapshot *) * new_capacity);
+            if (!temp)
+            {
+                // Cannot track it safely; leaking beats freeing under a reader
+                reclaimSnapshots();
+                return 1;
+            }
+            retired = temp;
+            retired_capacity = new_capacity;
         }
+        retired[retired_count++] = old;
     }
-}
\ No newline at end of file
+    reclaimSnapshots();
+    return 1;
+}
+
+void freeSnapshots(void)
+{
+    TreeSnapshot *snap = atomic_exchange(&current_snapshot, NULL);
+    if (snap)
+        freeSnapshot(snap);
+    for (int k = 0; k < retired_count; k++)
+        freeSnapshot(retired[k]);
+    free(retired);
+    retired = NULL;
+    retired_count = 0;
+    retired_capacity = 0;
+}
@@ -1,45 +1,90 @@
 #ifndef TREE_H
 #define TREE_H
 
-#define MAX_NODES 128
+#define INITIAL_NODES 128
 #define STACK_SIZE 512
 #define MAX_INPUT_SIZE 512
+#define MAX_READERS 64
 
+// Nodes live in a growable array in creation order; slot 1 is the root and
+// 0 means "no node". Children are explicit slot links, so memory follows
+// the real node count however deep or sparse the tree is. heap_index is
+// the node's position in the implicit layout (root 1, children 2i/2i+1),
+// kept for display; it is 0 once the tree is too deep to number in 64 bits.
 typedef struct
 {
     char data;
     int left;
     int right;
+    unsigned long long heap_index;
 } TreeNode;
 
 typedef struct
 {
-    int items[STACK_SIZE];
+    int *items;
     int top;
+    int capacity;
 } Stack;
 
-extern TreeNode tree[MAX_NODES];
+// Immutable published tree; see the snapshot functions below
+typedef struct
+{
+    TreeNode *nodes;
+    int node_count;
+    int root_index;
+} TreeSnapshot;
+
+extern TreeNode *tree;
 extern int node_count;
 
 // --- Utility Functions ---
 void initialize(Stack *s);
+void freeStack(Stack *s);
 int isEmpty(Stack *s);
 void push(Stack *s, int value);
 int pop(Stack *s);
 int isValidNode(int index);
 
+// --- Tree Storage ---
+void resetTree(void);
+void freeTree(void);
+int newNode(char data, unsigned long long heap_index);
+
 // --- Parsing Functions ---
 int parseTree(const char *input_string);
-int parseNode(const char *str, int *i, int parent_index, int side);
 void parseChildren(const char *str, int *i, int current_node_index);
 void skipWhitespace(const char *str, int *i);
-int getNextIndex();
+unsigned long long getNextIndex(unsigned long long parent_heap_index, int side);
 
 // --- Traversal Functions ---
+typedef void (*NodeVisitor)(int index, void *ctx);
+
+// Fused walk: each visitor (may be NULL) sees the nodes in its order
+void traverse(int root_index, NodeVisitor pre, NodeVisitor in, NodeVisitor post,
+              void *ctx, Stack *scratch);
+// Write node data in pre/in/post order into buffers of node_count bytes
+// (any may be NULL); returns the number of nodes visited
+int traversal_orders(int root_index, char *pre, char *in, char *post, Stack *scratch);
+int snapshot_traversal_orders(const TreeSnapshot *snap, char *pre, char *in, char *post, Stack *scratch);
+void print_traversals(int root_index);
+
 void preorder_iterative(int root_index);
 void inorder_iterative(int root_index);
 void postorder_iterative(int root_index);
 
 void printTreeArray(int root_index);
 
-#endif
\ No newline at end of file
+// --- Snapshots ---
+// One writer builds the next tree with parseTree and hands it over with
+// publishSnapshot. Any number of reader threads (each with its own
+// registered slot) can acquire the current snapshot and traverse it without
+// locks while the writer keeps building; a replaced snapshot is freed once
+// no reader holds it.
+int registerReader(void);  // -1 when all MAX_READERS slots are taken
+void unregisterReader(int reader);
+const TreeSnapshot *acquireSnapshot(int reader);  // NULL before the first publish
+void releaseSnapshot(int reader);
+int publishSnapshot(int root_index);  // takes over the global tree; 0 on failure
+void freeSnapshots(void);             // shutdown, with no readers left
+
+#endif
@@ -1,24 +1,112 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <time.h>
 
 #ifdef _WIN32
 #include <windows.h>
-double get_time() {
+long long get_time_ns() {
     LARGE_INTEGER freq, counter;
     QueryPerformanceFrequency(&freq);
     QueryPerformanceCounter(&counter);
-    return (double)counter.QuadPart / freq.QuadPart;
+    return (long long)((double)counter.QuadPart * 1e9 / freq.QuadPart);
 }
 #else
-#include <sys/time.h>
-double get_time() {
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
-    return tv.tv_sec + tv.tv_usec / 1e6;
+long long get_time_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
 }
 #endif
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define HAVE_X86_DISPATCH 1
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+unsigned long long read_cycles() { return __rdtsc(); }
+#else
+unsigned long long read_cycles() { return 0; }  // no cycle counter: cycles/op reads 0
+#endif
+
+// Stops the compiler from moving or dropping work across this point
+#define COMPILER_BARRIER() __asm__ __volatile__("" ::: "memory")
+
+// ============================================
+// BENCHMARK HARNESS
+// ============================================
+
+// Any search can be benchmarked through this signature
+typedef int (*SearchFn)(void* ctx, int target, int* count);
+
+typedef struct {
+    double min_ns;
+    double median_ns;
+    double p99_ns;
+    double cycles_per_op;  // TSC ticks of the median sample
+} BenchResult;
+
+#define BENCH_WARMUP 10000
+#define BENCH_SAMPLES 201
+#define BENCH_BATCH 1000
+
+static volatile int bench_sink;
+
+typedef struct {
+    double ns;
+    double cycles;
+} BenchSample;
+
+static int compare_sample(const void* a, const void* b) {
+    double x = ((const BenchSample*)a)->ns, y = ((const BenchSample*)b)->ns;
+    return (x > y) - (x < y);
+}
+
+// Each sample times BENCH_BATCH calls cycling through targets, so clock
+// overhead is spread over many operations. Results are per operation.
+BenchResult benchmark(SearchFn fn, void* ctx, const int targets[], int num_targets) {
+    BenchSample samples[BENCH_SAMPLES];
+    int found = 0;
+
+    for (int i = 0; i < BENCH_WARMUP; i++) {
+        int count = 0;
+        found += fn(ctx, targets[i % num_targets], &count);
+    }
+
+    for (int s = 0; s < BENCH_SAMPLES; s++) {
+        COMPILER_BARRIER();
+        long long t0 = get_time_ns();
+        unsigned long long c0 = read_cycles();
+        COMPILER_BARRIER();
+        for (int i = 0; i < BENCH_BATCH; i++) {
+            int count = 0;
+            found += fn(ctx, targets[i % num_targets], &count);
+            COMPILER_BARRIER();
+        }
+        COMPILER_BARRIER();
+        unsigned long long c1 = read_cycles();
+        long long t1 = get_time_ns();
+        samples[s].ns = (double)(t1 - t0) / BENCH_BATCH;
+        samples[s].cycles = (double)(c1 - c0) / BENCH_BATCH;
+    }
+    bench_sink = found;
+
+    qsort(samples, BENCH_SAMPLES, sizeof(BenchSample), compare_sample);
+    BenchResult r;
+    r.min_ns = samples[0].ns;
+    r.median_ns = samples[BENCH_SAMPLES / 2].ns;
+    r.p99_ns = samples[(BENCH_SAMPLES * 99) / 100].ns;
+    r.cycles_per_op = samples[BENCH_SAMPLES / 2].cycles;
+    return r;
+}
+
+void print_bench(BenchResult r) {
+    printf("  Time per search: median %.2f ns, min %.2f ns, p99 %.2f ns (%.1f cycles)\n",
+           r.median_ns, r.min_ns, r.p99_ns, r.cycles_per_op);
+}
+
 // Binary Search Tree (BST) Structure 
 typedef struct Node {
     int data;
@@ -59,6 +147,90 @@ int searchBST_iterative(Node* root, int target, int* count) {
     return 0;
 }
 
+// Eytzinger (BFS-layout) static search tree
+// Read-only search tree stored as an array in BFS order: the children of
+// keys[k] are keys[2k] and keys[2k+1], root at 1. A whole descent touches
+// one small contiguous array instead of malloc'd nodes.
+typedef struct {
+    void* block;  // allocation, keys is aligned inside it
+    int* keys;    // keys[1..n]
+    int n;
+} Eytzinger;
+
+int compareInt(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// In-order walk over BFS positions hands out the sorted keys
+int eytzingerFill(const int sorted[], int* keys, int n, int i, int k) {
+    if (k <= n) {
+        i = eytzingerFill(sorted, keys, n, i, 2 * k);
+        keys[k] = sorted[i++];
+        i = eytzingerFill(sorted, keys, n, i, 2 * k + 1);
+    }
+    return i;
+}
+
+Eytzinger* buildEytzinger(const int data[], int n) {
+    Eytzinger* t = (Eytzinger*)malloc(sizeof(Eytzinger));
+    int* sorted = (int*)malloc(sizeof(int) * (n > 0 ? n : 1));
+    if (!t || !sorted) {
+        free(t);
+        free(sorted);
+        return NULL;
+    }
+
+    // Sorted and deduplicated, like the BST/AVL which ignore repeats
+    for (int i = 0; i < n; i++) sorted[i] = data[i];
+    qsort(sorted, n, sizeof(int), compareInt);
+    int unique = 0;
+    for (int i = 0; i < n; i++) {
+        if (unique == 0 || sorted[i] != sorted[unique - 1])
+            sorted[unique++] = sorted[i];
+    }
+
+    // keys[0] starts a 64-byte line, so keys[16k..16k+15] share one line
+    t->block = malloc(sizeof(int) * ((size_t)unique + 1) + 64);
+    if (!t->block) {
+        free(sorted);
+        free(t);
+        return NULL;
+    }
+    t->keys = (int*)(((size_t)t->block + 63) & ~(size_t)63);
+    t->n = unique;
+    eytzingerFill(sorted, t->keys, unique, 0, 1);
+
+    free(sorted);
+    return t;
+}
+
+int searchEytzinger(const Eytzinger* t, int target, int* count) {
+    const int* keys = t->keys;
+    int k = 1;
+    while (k <= t->n) {
+        // Fetch the line holding the descendants four levels down. Near the
+        // leaves that address is past the array; a prefetch never faults,
+        // but it is formed as an integer so no out-of-bounds pointer exists.
+        __builtin_prefetch((const void*)((uintptr_t)keys + 64 * (uintptr_t)k));
+        (*count)++;
+        k = 2 * k + (keys[k] < target);  // branchless step
+    }
+    // Undo the right turns taken after the last left turn: that node is
+    // the first key >= target
+    k >>= __builtin_ffs(~k);
+    if (k == 0)
+        return 0;
+    (*count)++;
+    return keys[k] == target;
+}
+
+void freeEytzinger(Eytzinger* t) {
+    if (t == NULL) return;
+    free(t->block);
+    free(t);
+}
+
 // Linear search in an array
 int linearSearch(int arr[], int n, int target, int* count) {
     for (int i = 0; i < n; i++) {
@@ -69,6 +241,188 @@ int linearSearch(int arr[], int n, int target, int* count) {
     return 0;
 }
 
+// SIMD linear search: compares 8 (AVX2) or 4 (SSE2) ints per instruction,
+// four vectors per iteration, and stops at the first vector group with a
+// match. The kernel is picked once at run time from what the CPU supports.
+int findIntScalar(const int arr[], int n, int target) {
+    for (int i = 0; i < n; i++) {
+        if (arr[i] == target)
+            return i;
+    }
+    return -1;
+}
+
+#ifdef HAVE_X86_DISPATCH
+__attribute__((target("avx2")))
+int findIntAVX2(const int arr[], int n, int target) {
+    __m256i t = _mm256_set1_epi32(target);
+    int i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i e0 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i)), t);
+        __m256i e1 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i + 8)), t);
+        __m256i e2 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i + 16)), t);
+        __m256i e3 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i + 24)), t);
+        __m256i any = _mm256_or_si256(_mm256_or_si256(e0, e1), _mm256_or_si256(e2, e3));
+        if (!_mm256_testz_si256(any, any)) {
+            unsigned int m = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(e0)) |
+                             (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(e1)) << 8 |
+                             (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(e2)) << 16 |
+                             (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(e3)) << 24;
+            return i + __builtin_ctz(m);
+        }
+    }
+    for (; i + 8 <= n; i += 8) {
+        __m256i e = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i)), t);
+        int m = _mm256_movemask_ps(_mm256_castsi256_ps(e));
+        if (m)
+            return i + __builtin_ctz((unsigned int)m);
+    }
+    for (; i < n; i++) {
+        if (arr[i] == target)
+            return i;
+    }
+    return -1;
+}
+
+__attribute__((target("sse2")))
+int findIntSSE2(const int arr[], int n, int target) {
+    __m128i t = _mm_set1_epi32(target);
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i e0 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i)), t);
+        __m128i e1 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i + 4)), t);
+        __m128i e2 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i + 8)), t);
+        __m128i e3 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i + 12)), t);
+        __m128i any = _mm_or_si128(_mm_or_si128(e0, e1), _mm_or_si128(e2, e3));
+        if (_mm_movemask_epi8(any)) {
+            unsigned int m = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(e0)) |
+                             (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(e1)) << 4 |
+                             (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(e2)) << 8 |
+                             (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(e3)) << 12;
+            return i + __builtin_ctz(m);
+        }
+    }
+    for (; i < n; i++) {
+        if (arr[i] == target)
+            return i;
+    }
+    return -1;
+}
+#endif
+
+typedef int (*FindIntFn)(const int arr[], int n, int target);
+
+FindIntFn resolveFindInt() {
+#ifdef HAVE_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return findIntAVX2;
+    if (__builtin_cpu_supports("sse2"))
+        return findIntSSE2;
+#endif
+    return findIntScalar;
+}
+
+// Same result and comparison count as linearSearch
+int linearSearchSIMD(int arr[], int n, int target, int* count) {
+    static FindIntFn find = NULL;
+    if (find == NULL)
+        find = resolveFindInt();
+    int index = find(arr, n, target);
+    *count += index >= 0 ? index + 1 : n;
+    return index >= 0;
+}
+
+// Adapters so both searches fit SearchFn
+typedef struct {
+    int* arr;
+    int n;
+} ArrayCtx;
+
+int linear_search_fn(void* ctx, int target, int* count) {
+    ArrayCtx* a = (ArrayCtx*)ctx;
+    return linearSearch(a->arr, a->n, target, count);
+}
+
+int linear_search_simd_fn(void* ctx, int target, int* count) {
+    ArrayCtx* a = (ArrayCtx*)ctx;
+    return linearSearchSIMD(a->arr, a->n, target, count);
+}
+
+int bst_search_fn(void* ctx, int target, int* count) {
+    return searchBST_iterative((Node*)ctx, target, count);
+}
+
+int eytzinger_search_fn(void* ctx, int target, int* count) {
+    return searchEytzinger((const Eytzinger*)ctx, target, count);
+}
+
+void freeBST(Node* root) {
+    if (root == NULL)
+        return;
+    freeBST(root->left);
+    freeBST(root->right);
+    free(root);
+}
+
+// SIMD linear search beats the trees on small arrays and loses once n grows.
+// Sweep n on unique random keys with random hit targets and print median
+// ns per search, so the crossover can be read off for this machine.
+#define CROSSOVER_TARGETS 1024
+
+void crossover_table() {
+    static const int sizes[] = { 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192 };
+    int num_sizes = (int)(sizeof(sizes) / sizeof(sizes[0]));
+    int max_n = sizes[num_sizes - 1];
+    int* pool = (int*)malloc(sizeof(int) * max_n * 4);
+    int* targets = (int*)malloc(sizeof(int) * CROSSOVER_TARGETS);
+    if (pool == NULL || targets == NULL) {
+        free(pool);
+        free(targets);
+        return;
+    }
+
+    // Shuffled distinct keys; a prefix of length n is a unique random set
+    for (int i = 0; i < max_n * 4; i++)
+        pool[i] = i;
+    for (int i = max_n * 4 - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        int t = pool[i];
+        pool[i] = pool[j];
+        pool[j] = t;
+    }
+
+    printf("\n--- Crossover (median ns per search) ---\n");
+    printf("%8s %10s %10s %10s %10s\n", "n", "Linear", "SIMD", "BST", "Eytzinger");
+    for (int s = 0; s < num_sizes; s++) {
+        int n = sizes[s];
+        Node* root = NULL;
+        for (int i = 0; i < n; i++)
+            root = insert(root, pool[i]);
+        Eytzinger* eytzinger = buildEytzinger(pool, n);
+        for (int i = 0; i < CROSSOVER_TARGETS; i++)
+            targets[i] = pool[rand() % n];
+
+        ArrayCtx arrCtx = { pool, n };
+        BenchResult linearBench = benchmark(linear_search_fn, &arrCtx, targets, CROSSOVER_TARGETS);
+        BenchResult simdBench = benchmark(linear_search_simd_fn, &arrCtx, targets, CROSSOVER_TARGETS);
+        BenchResult bstBench = benchmark(bst_search_fn, root, targets, CROSSOVER_TARGETS);
+        printf("%8d %10.2f %10.2f %10.2f ", n, linearBench.median_ns, simdBench.median_ns, bstBench.median_ns);
+        if (eytzinger != NULL) {
+            BenchResult eytzingerBench = benchmark(eytzinger_search_fn, eytzinger, targets, CROSSOVER_TARGETS);
+            printf("%10.2f\n", eytzingerBench.median_ns);
+        } else {
+            printf("%10s\n", "-");
+        }
+
+        freeEytzinger(eytzinger);
+        freeBST(root);
+    }
+
+    free(pool);
+    free(targets);
+}
+
 int main() {
     int arr[100];
     Node* root = NULL;
@@ -84,26 +438,48 @@ int main() {
 
     //Linear search in array
     int linearCount = 0;
-    double start1 = get_time();
     int foundLinear = linearSearch(arr, 100, target, &linearCount);
-    double end1 = get_time();
+    ArrayCtx arrCtx = { arr, 100 };
+    BenchResult linearBench = benchmark(linear_search_fn, &arrCtx, &target, 1);
+
+    //SIMD linear search in array
+    int simdCount = 0;
+    int foundSIMD = linearSearchSIMD(arr, 100, target, &simdCount);
+    BenchResult simdBench = benchmark(linear_search_simd_fn, &arrCtx, &target, 1);
 
     //BST search
     int bstCount = 0;
-    double start2 = get_time();
     int foundBST = searchBST_iterative(root, target, &bstCount);
-    double end2 = get_time();
+    BenchResult bstBench = benchmark(bst_search_fn, root, &target, 1);
+
+    //Eytzinger search
+    Eytzinger* eytzinger = buildEytzinger(arr, 100);
+    int eytzingerCount = 0;
+    int foundEytzinger = searchEytzinger(eytzinger, target, &eytzingerCount);
+    BenchResult eytzingerBench = benchmark(eytzinger_search_fn, eytzinger, &target, 1);
 
     //Print comparison results
     printf("\n--- Search Performance Comparison ---\n");
 
     printf("Linear Search: %s\n", foundLinear ? "Found" : "Not Found");
     printf("  Comparisons: %d\n", linearCount);
-    printf("  Time taken: %.9f seconds (%.3f μs)\n", end1 - start1, (end1 - start1) * 1e6);
+    print_bench(linearBench);
+
+    printf("\nLinear Search (SIMD): %s\n", foundSIMD ? "Found" : "Not Found");
+    printf("  Comparisons: %d\n", simdCount);
+    print_bench(simdBench);
 
     printf("\nBST Search (Iterative): %s\n", foundBST ? "Found" : "Not Found");
     printf("  Comparisons: %d\n", bstCount);
-    printf("  Time taken: %.9f seconds (%.3f μs)\n", end2 - start2, (end2 - start2) * 1e6);
+    print_bench(bstBench);
+
+    printf("\nEytzinger Search: %s\n", foundEytzinger ? "Found" : "Not Found");
+    printf("  Comparisons: %d\n", eytzingerCount);
+    print_bench(eytzingerBench);
+
+    freeEytzinger(eytzinger);
+    freeBST(root);
 
+    crossover_table();
     return 0;
 }
@@ -1,7 +1,16 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
 #include <time.h>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define HAVE_X86_DISPATCH 1
+#endif
+
 // ============================================
 // ARRAY FUNCTIONS
 // ============================================
@@ -15,6 +24,98 @@ int linearSearch(int arr[], int n, int target, int* count) {
     return 0;  
 }
 
+// SIMD linear search: compares 8 (AVX2) or 4 (SSE2) ints per instruction,
+// four vectors per iteration, and stops at the first vector group with a
+// match. The kernel is picked once at run time from what the CPU supports.
+int findIntScalar(const int arr[], int n, int target) {
+    for (int i = 0; i < n; i++) {
+        if (arr[i] == target)
+            return i;
+    }
+    return -1;
+}
+
+#ifdef HAVE_X86_DISPATCH
+__attribute__((target("avx2")))
+int findIntAVX2(const int arr[], int n, int target) {
+    __m256i t = _mm256_set1_epi32(target);
+    int i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i e0 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i)), t);
+        __m256i e1 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i + 8)), t);
+        __m256i e2 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i + 16)), t);
+        __m256i e3 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i + 24)), t);
+        __m256i any = _mm256_or_si256(_mm256_or_si256(e0, e1), _mm256_or_si256(e2, e3));
+        if (!_mm256_testz_si256(any, any)) {
+            unsigned int m = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(e0)) |
+                             (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(e1)) << 8 |
+                             (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(e2)) << 16 |
+                             (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(e3)) << 24;
+            return i + __builtin_ctz(m);
+        }
+    }
+    for (; i + 8 <= n; i += 8) {
+        __m256i e = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i)), t);
+        int m = _mm256_movemask_ps(_mm256_castsi256_ps(e));
+        if (m)
+            return i + __builtin_ctz((unsigned int)m);
+    }
+    for (; i < n; i++) {
+        if (arr[i] == target)
+            return i;
+    }
+    return -1;
+}
+
+__attribute__((target("sse2")))
+int findIntSSE2(const int arr[], int n, int target) {
+    __m128i t = _mm_set1_epi32(target);
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i e0 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i)), t);
+        __m128i e1 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i + 4)), t);
+        __m128i e2 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i + 8)), t);
+        __m128i e3 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i + 12)), t);
+        __m128i any = _mm_or_si128(_mm_or_si128(e0, e1), _mm_or_si128(e2, e3));
+        if (_mm_movemask_epi8(any)) {
+            unsigned int m = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(e0)) |
+                             (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(e1)) << 4 |
+                             (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(e2)) << 8 |
+                             (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(e3)) << 12;
+            return i + __builtin_ctz(m);
+        }
+    }
+    for (; i < n; i++) {
+        if (arr[i] == target)
+            return i;
+    }
+    return -1;
+}
+#endif
+
+typedef int (*FindIntFn)(const int arr[], int n, int target);
+
+FindIntFn resolveFindInt() {
+#ifdef HAVE_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return findIntAVX2;
+    if (__builtin_cpu_supports("sse2"))
+        return findIntSSE2;
+#endif
+    return findIntScalar;
+}
+
+// Same result and comparison count as linearSearch
+int linearSearchSIMD(int arr[], int n, int target, int* count) {
+    static FindIntFn find = NULL;
+    if (find == NULL)
+        find = resolveFindInt();
+    int index = find(arr, n, target);
+    *count += index >= 0 ? index + 1 : n;
+    return index >= 0;
+}
+
 // ============================================
 // BST (Binary Search Tree) FUNCTIONS
 // ============================================
@@ -55,6 +156,56 @@ int searchBST(Node* root, int target, int* count) {
     return 0;  
 }
 
+// Batched lookup: SEARCH_GROUP descents run interleaved. Each step advances
+// one descent by a node and prefetches its next node, so the other lanes'
+// work covers that cache miss; a finished lane picks up the next target.
+// found[i] and counts[i] get the same result and comparison count that
+// searchBST gives for targets[i].
+#define SEARCH_GROUP 16
+
+void searchBSTBatch(Node* root, const int targets[], int n, int found[], int counts[]) {
+    Node* cur[SEARCH_GROUP];
+    int lane[SEARCH_GROUP];
+    int active = 0, next = 0;
+
+    for (; active < SEARCH_GROUP && next < n; active++, next++) {
+        lane[active] = next;
+        cur[active] = root;
+        found[next] = 0;
+        counts[next] = 0;
+    }
+    while (active > 0) {
+        for (int s = 0; s < active;) {
+            int k = lane[s];
+            Node* node = cur[s];
+            if (node != NULL) {
+                counts[k]++;
+                if (targets[k] == node->data) {
+                    found[k] = 1;
+                    node = NULL;
+                } else {
+                    node = targets[k] < node->data ? node->left : node->right;
+                }
+            }
+            if (node != NULL) {
+                __builtin_prefetch(node);
+                cur[s++] = node;
+            } else if (next < n) {
+                lane[s] = next;
+                cur[s++] = root;
+                found[next] = 0;
+                counts[next] = 0;
+                next++;
+            } else {
+                // Retire the lane; the last one moves here and runs next
+                active--;
+                lane[s] = lane[active];
+                cur[s] = cur[active];
+            }
+        }
+    }
+}
+
 void freeBST(Node* root) {
     if (root == NULL) return;
     freeBST(root->left);
@@ -70,6 +221,7 @@ typedef struct AVLNode {
     int data;
     struct AVLNode *left, *right;
     int height;
+    int pooled;  // lives in a bulk-load pool, not its own malloc
 } AVLNode;
 
 AVLNode* createAVLNode(int value) {
@@ -77,6 +229,7 @@ AVLNode* createAVLNode(int value) {
     newNode->data = value;
     newNode->left = newNode->right = NULL;
     newNode->height = 1;
+    newNode->pooled = 0;
     return newNode;
 }
 
@@ -163,116 +316,932 @@ int searchAVL(AVLNode* root, int target, int* count) {
     return 0;  
 }
 
-// Free AVL
+// Same interleaved walk as searchBSTBatch
+void searchAVLBatch(AVLNode* root, const int targets[], int n, int found[], int counts[]) {
+    AVLNode* cur[SEARCH_GROUP];
+    int lane[SEARCH_GROUP];
+    int active = 0, next = 0;
+
+    for (; active < SEARCH_GROUP && next < n; active++, next++) {
+        lane[active] = next;
+        cur[active] = root;
+        found[next] = 0;
+        counts[next] = 0;
+    }
+    while (active > 0) {
+        for (int s = 0; s < active;) {
+            int k = lane[s];
+            AVLNode* node = cur[s];
+            if (node != NULL) {
+                counts[k]++;
+                if (targets[k] == node->data) {
+                    found[k] = 1;
+                    node = NULL;
+                } else {
+                    node = targets[k] < node->data ? node->left : node->right;
+                }
+            }
+            if (node != NULL) {
+                __builtin_prefetch(node);
+                cur[s++] = node;
+            } else if (next < n) {
+                lane[s] = next;
+                cur[s++] = root;
+                found[next] = 0;
+                counts[next] = 0;
+                next++;
+            } else {
+                active--;
+                lane[s] = lane[active];
+                cur[s] = cur[active];
+            }
+        }
+    }
+}
+
+// 1 if keys are strictly ascending, -1 if strictly descending, 0 otherwise
+int sortedOrder(const int keys[], int n) {
+    int ascending = 1, descending = 1;
+    for (int i = 1; i < n && (ascending || descending); i++) {
+        if (keys[i] <= keys[i - 1]) ascending = 0;
+        if (keys[i] >= keys[i - 1]) descending = 0;
+    }
+    return ascending ? 1 : descending ? -1 : 0;
+}
+
+// The middle key of each range becomes the subtree root, so the tree is
+// perfectly balanced and no rotation is ever needed. Node i of the pool
+// holds the i-th smallest key.
+AVLNode* buildAVLRange(AVLNode* pool, const int keys[], int n, int descending, int lo, int hi) {
+    if (lo >= hi)
+        return NULL;
+    int mid = lo + (hi - lo) / 2;
+    AVLNode* node = &pool[mid];
+    node->data = keys[descending ? n - 1 - mid : mid];
+    node->left = buildAVLRange(pool, keys, n, descending, lo, mid);
+    node->right = buildAVLRange(pool, keys, n, descending, mid + 1, hi);
+    node->height = max(height(node->left), height(node->right)) + 1;
+    node->pooled = 1;
+    return node;
+}
+
+// O(n) bulk load of strictly sorted keys (ascending, or descending when
+// descending != 0) into one contiguous node pool. Returns the root and the
+// pool in *pool, which the caller frees after freeAVL; NULL on failure.
+AVLNode* buildAVLSorted(const int keys[], int n, int descending, AVLNode** pool) {
+    *pool = NULL;
+    if (n <= 0)
+        return NULL;
+    *pool = (AVLNode*)malloc(sizeof(AVLNode) * (size_t)n);
+    if (*pool == NULL)
+        return NULL;
+    return buildAVLRange(*pool, keys, n, descending, 0, n);
+}
+
+// Free AVL (pooled nodes are released with their pool)
 void freeAVL(AVLNode* root) {
     if (root == NULL) return;
     freeAVL(root->left);
     freeAVL(root->right);
-    free(root);
+    if (!root->pooled)
+        free(root);
+}
+
+// ============================================
+// EYTZINGER (BFS-LAYOUT) STATIC SEARCH TREE
+// ============================================
+
+// Read-only search tree stored as an array in BFS order: the children of
+// keys[k] are keys[2k] and keys[2k+1], root at 1. A whole descent touches
+// one small contiguous array instead of malloc'd nodes.
+typedef struct {
+    void* block;  // allocation, keys is aligned inside it
+    int* keys;    // keys[1..n]
+    int n;
+} Eytzinger;
+
+int compareInt(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// In-order walk over BFS positions hands out the sorted keys
+int eytzingerFill(const int sorted[], int* keys, int n, int i, int k) {
+    if (k <= n) {
+        i = eytzingerFill(sorted, keys, n, i, 2 * k);
+        keys[k] = sorted[i++];
+        i = eytzingerFill(sorted, keys, n, i, 2 * k + 1);
+    }
+    return i;
+}
+
+Eytzinger* buildEytzinger(const int data[], int n) {
+    Eytzinger* t = (Eytzinger*)malloc(sizeof(Eytzinger));
+    int* sorted = (int*)malloc(sizeof(int) * (n > 0 ? n : 1));
+    if (!t || !sorted) {
+        free(t);
+        free(sorted);
+        return NULL;
+    }
+
+    // Sorted and deduplicated, like the BST/AVL which ignore repeats
+    for (int i = 0; i < n; i++) sorted[i] = data[i];
+    qsort(sorted, n, sizeof(int), compareInt);
+    int unique = 0;
+    for (int i = 0; i < n; i++) {
+        if (unique == 0 || sorted[i] != sorted[unique - 1])
+            sorted[unique++] = sorted[i];
+    }
+
+    // keys[0] starts a 64-byte line, so keys[16k..16k+15] share one line
+    t->block = malloc(sizeof(int) * ((size_t)unique + 1) + 64);
+    if (!t->block) {
+        free(sorted);
+        free(t);
+        return NULL;
+    }
+    t->keys = (int*)(((size_t)t->block + 63) & ~(size_t)63);
+    t->n = unique;
+    eytzingerFill(sorted, t->keys, unique, 0, 1);
+
+    free(sorted);
+    return t;
+}
+
+int searchEytzinger(const Eytzinger* t, int target, int* count) {
+    const int* keys = t->keys;
+    int k = 1;
+    while (k <= t->n) {
+        // Fetch the line holding the descendants four levels down. Near the
+        // leaves that address is past the array; a prefetch never faults,
+        // but it is formed as an integer so no out-of-bounds pointer exists.
+        __builtin_prefetch((const void*)((uintptr_t)keys + 64 * (uintptr_t)k));
+        (*count)++;
+        k = 2 * k + (keys[k] < target);  // branchless step
+    }
+    // Undo the right turns taken after the last left turn: that node is
+    // the first key >= target
+    k >>= __builtin_ffs(~k);
+    if (k == 0)
+        return 0;
+    (*count)++;
+    return keys[k] == target;
+}
+
+void freeEytzinger(Eytzinger* t) {
+    if (t == NULL) return;
+    free(t->block);
+    free(t);
+}
+
+// ============================================
+// B+ TREE (CACHE-LINE NODES, SIMD IN-NODE SEARCH)
+// ============================================
+
+// 16 int keys fill one 64-byte line. Unused key slots hold INT_MAX so the
+// in-node search can always compare all 16 lanes.
+#define BPLUS_ORDER 16
+
+typedef struct BPlusNode {
+    int keys[BPLUS_ORDER];  // first member: starts on the aligned line
+    int numKeys;
+    int isLeaf;
+    struct BPlusNode* children[BPLUS_ORDER + 1];  // internal nodes
+    struct BPlusNode* next;                       // leaf chain for range scans
+    void* block;                                  // allocation to free
+} BPlusNode;
+
+// Bounds the tree height: every node but the root holds at least 8 keys
+#define BPLUS_MAX_HEIGHT 32
+
+typedef struct {
+    BPlusNode* root;
+    int count;
+    int height;                                // levels, 0 when empty
+    BPlusNode* spare[BPLUS_MAX_HEIGHT + 1];    // reserved for splits
+    int numSpare;
+} BPlusTree;
+
+BPlusNode* createBPlusNode(int isLeaf) {
+    void* block = malloc(sizeof(BPlusNode) + 63);
+    if (!block) return NULL;
+    BPlusNode* node = (BPlusNode*)(((size_t)block + 63) & ~(size_t)63);
+    for (int i = 0; i < BPLUS_ORDER; i++) node->keys[i] = INT_MAX;
+    for (int i = 0; i <= BPLUS_ORDER; i++) node->children[i] = NULL;
+    node->numKeys = 0;
+    node->isLeaf = isLeaf;
+    node->next = NULL;
+    node->block = block;
+    return node;
+}
+
+// Number of keys in node < target (lessThan = 1) or <= target (lessThan = 0).
+// The AVX2 kernel compares all 16 lanes at once; it is picked at run time
+// like the linear search kernels.
+int bplusRankScalar(const BPlusNode* node, int target, int lessThan) {
+    int rank = 0;
+    for (int i = 0; i < node->numKeys; i++) {
+        if (node->keys[i] < target || (!lessThan && node->keys[i] == target)) rank++;
+    }
+    return rank;
+}
+
+#ifdef HAVE_X86_DISPATCH
+__attribute__((target("avx2")))
+int bplusRankAVX2(const BPlusNode* node, int target, int lessThan) {
+    // Lanes where key > target (or key >= target); padding always counts
+    __m256i t = _mm256_set1_epi32(lessThan ? target - 1 : target);
+    __m256i lo = _mm256_loadu_si256((const __m256i*)node->keys);
+    __m256i hi = _mm256_loadu_si256((const __m256i*)(node->keys + 8));
+    unsigned int gt = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(lo, t))) |
+                      ((unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(hi, t))) << 8);
+    int rank = BPLUS_ORDER - __builtin_popcount(gt);
+    return rank < node->numKeys ? rank : node->numKeys;  // padding when target == INT_MAX
+}
+#endif
+
+typedef int (*BPlusRankFn)(const BPlusNode* node, int target, int lessThan);
+
+BPlusRankFn resolveBPlusRank() {
+#ifdef HAVE_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return bplusRankAVX2;
+#endif
+    return bplusRankScalar;
+}
+
+// Set once from main; scalar until then
+BPlusRankFn bplusRankKernel = bplusRankScalar;
+
+int bplusRank(const BPlusNode* node, int target, int lessThan) {
+    if (lessThan && target == INT_MIN) return 0;
+    return bplusRankKernel(node, target, lessThan);
+}
+
+// Insert into a full node's key (and child) arrays through a temporary
+// copy, then split it into right, a fresh node. *upKey gets the key that
+// moves up.
+void splitBPlusNode(BPlusNode* node, BPlusNode* right, int pos, int key, BPlusNode* child, int* upKey) {
+    int keys[BPLUS_ORDER + 1];
+    BPlusNode* children[BPLUS_ORDER + 2];
+
+    for (int i = 0, j = 0; i <= BPLUS_ORDER; i++) keys[i] = (i == pos) ? key : node->keys[j++];
+    if (!node->isLeaf) {
+        for (int i = 0, j = 0; i <= BPLUS_ORDER + 1; i++)
+            children[i] = (i == pos + 1) ? child : node->children[j++];
+    }
+
+    int total = BPLUS_ORDER + 1;
+    int leftCount = total / 2;
+    right->isLeaf = node->isLeaf;
+    for (int i = 0; i < BPLUS_ORDER; i++) node->keys[i] = INT_MAX;
+
+    if (node->isLeaf) {
+        // Leaves keep every key; the first right key is copied up
+        for (int i = 0; i < leftCount; i++) node->keys[i] = keys[i];
+        for (int i = leftCount; i < total; i++) right->keys[i - leftCount] = keys[i];
+        node->numKeys = leftCount;
+        right->numKeys = total - leftCount;
+        right->next = node->next;
+        node->next = right;
+        *upKey = right->keys[0];
+    } else {
+        // Internal nodes move the middle key up
+        for (int i = 0; i < leftCount; i++) node->keys[i] = keys[i];
+        for (int i = leftCount + 1; i < total; i++) right->keys[i - leftCount - 1] = keys[i];
+        for (int i = 0; i <= BPLUS_ORDER; i++) node->children[i] = NULL;
+        for (int i = 0; i <= leftCount; i++) node->children[i] = children[i];
+        for (int i = leftCount + 1; i <= total; i++) right->children[i - leftCount - 1] = children[i];
+        node->numKeys = leftCount;
+        right->numKeys = total - leftCount - 1;
+        *upKey = keys[leftCount];
+    }
+}
+
+// Split node using a reserved spare; -1 if none is left
+int splitWithSpare(BPlusTree* tree, BPlusNode* node, int pos, int key, BPlusNode* child,
+                   BPlusNode** sibling, int* upKey) {
+    if (tree->numSpare == 0) return -1;
+    *sibling = tree->spare[--tree->numSpare];
+    splitBPlusNode(node, *sibling, pos, key, child, upKey);
+    return 1;
+}
+
+// 1 when key was added, 0 when already present, -1 when out of nodes.
+// *sibling is the new right node when node split (separator in *upKey).
+int insertBPlusRec(BPlusTree* tree, BPlusNode* node, int key, BPlusNode** sibling, int* upKey) {
+    *sibling = NULL;
+    if (node->isLeaf) {
+        int pos = bplusRank(node, key, 1);
+        if (pos < node->numKeys && node->keys[pos] == key) return 0;  // already present
+        if (node->numKeys < BPLUS_ORDER) {
+            for (int i = node->numKeys; i > pos; i--) node->keys[i] = node->keys[i - 1];
+            node->keys[pos] = key;
+            node->numKeys++;
+            return 1;
+        }
+        return splitWithSpare(tree, node, pos, key, NULL, sibling, upKey);
+    }
+
+    int idx = bplusRank(node, key, 0);
+    int childUp;
+    BPlusNode* childSibling;
+    int status = insertBPlusRec(tree, node->children[idx], key, &childSibling, &childUp);
+    if (status <= 0 || childSibling == NULL) return status;
+
+    if (node->numKeys < BPLUS_ORDER) {
+        for (int i = node->numKeys; i > idx; i--) {
+            node->keys[i] = node->keys[i - 1];
+            node->children[i + 1] = node->children[i];
+        }
+        node->keys[idx] = childUp;
+        node->children[idx + 1] = childSibling;
+        node->numKeys++;
+        return 1;
+    }
+    return splitWithSpare(tree, node, idx, childUp, childSibling, sibling, upKey);
+}
+
+// 1 when key was added, 0 when already present, -1 when memory ran out.
+// Every level may split and the root may grow a level, so height + 1 spare
+// nodes are reserved before descending: a failed insert leaves the tree
+// exactly as it was instead of losing a split-off sibling.
+int insertBPlus(BPlusTree* tree, int key) {
+    if (tree->root == NULL) {
+        tree->root = createBPlusNode(1);
+        if (!tree->root) return -1;
+        tree->height = 1;
+    }
+    if (tree->height >= BPLUS_MAX_HEIGHT) return -1;
+    while (tree->numSpare < tree->height + 1) {
+        BPlusNode* node = createBPlusNode(1);
+        if (!node) return -1;
+        tree->spare[tree->numSpare++] = node;
+    }
+
+    int upKey;
+    BPlusNode* sibling;
+    int status = insertBPlusRec(tree, tree->root, key, &sibling, &upKey);
+    if (status > 0 && sibling) {
+        BPlusNode* newRoot = tree->spare[--tree->numSpare];
+        newRoot->isLeaf = 0;
+        newRoot->keys[0] = upKey;
+        newRoot->children[0] = tree->root;
+        newRoot->children[1] = sibling;
+        newRoot->numKeys = 1;
+        tree->root = newRoot;
+        tree->height++;
+    }
+    if (status > 0) tree->count++;
+    return status;
+}
+
+BPlusNode* findBPlusLeaf(const BPlusTree* tree, int target, int* count) {
+    BPlusNode* node = tree->root;
+    while (node != NULL && !node->isLeaf) {
+        (*count)++;  // one vector compare per node
+        node = node->children[bplusRank(node, target, 0)];
+    }
+    return node;
+}
+
+int searchBPlus(const BPlusTree* tree, int target, int* count) {
+    BPlusNode* leaf = findBPlusLeaf(tree, target, count);
+    if (leaf == NULL) return 0;
+    (*count)++;
+    int pos = bplusRank(leaf, target, 1);
+    return pos < leaf->numKeys && leaf->keys[pos] == target;
+}
+
+// Copy keys in [low, high] into out (at most maxOut); returns how many
+int rangeBPlus(const BPlusTree* tree, int low, int high, int out[], int maxOut) {
+    int count = 0;
+    int n = 0;
+    BPlusNode* leaf = findBPlusLeaf(tree, low, &count);
+    if (leaf == NULL) return 0;
+
+    int pos = bplusRank(leaf, low, 1);
+    while (leaf != NULL && n < maxOut) {
+        for (; pos < leaf->numKeys && n < maxOut; pos++) {
+            if (leaf->keys[pos] > high) return n;
+            out[n++] = leaf->keys[pos];
+        }
+        leaf = leaf->next;
+        pos = 0;
+    }
+    return n;
+}
+
+void freeBPlusNode(BPlusNode* node) {
+    if (node == NULL) return;
+    if (!node->isLeaf) {
+        for (int i = 0; i <= node->numKeys; i++) freeBPlusNode(node->children[i]);
+    }
+    free(node->block);
+}
+
+void freeBPlus(BPlusTree* tree) {
+    freeBPlusNode(tree->root);
+    while (tree->numSpare > 0) free(tree->spare[--tree->numSpare]->block);
+    tree->root = NULL;
+    tree->count = 0;
+    tree->height = 0;
 }
 
 // ============================================
 // UTILITY FUNCTIONS (for all data structures)
 // ============================================
 
-void shuffle(int arr[], int n) {
-    for (int i = n - 1; i > 0; i--) {
-        int j = rand() % (i + 1);
-        int temp = arr[i];
-        arr[i] = arr[j];
-        arr[j] = temp;
+#ifdef _WIN32
+#include <windows.h>
+long long get_time_ns() {
+    LARGE_INTEGER freq, counter;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (long long)((double)counter.QuadPart * 1e9 / freq.QuadPart);
+}
+#else
+long long get_time_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+#endif
+
+// Every structure is searched through this signature so runTest can time
+// them the same way
+typedef int (*SearchFn)(void* ctx, int target, int* count);
+
+typedef struct {
+    int* arr;
+    int n;
+} ArrayCtx;
+
+int linearSearchFn(void* ctx, int target, int* count) {
+    ArrayCtx* a = (ArrayCtx*)ctx;
+    return linearSearch(a->arr, a->n, target, count);
+}
+
+int linearSearchSIMDFn(void* ctx, int target, int* count) {
+    ArrayCtx* a = (ArrayCtx*)ctx;
+    return linearSearchSIMD(a->arr, a->n, target, count);
+}
+
+int bstSearchFn(void* ctx, int target, int* count) {
+    return searchBST((Node*)ctx, target, count);
+}
+
+int avlSearchFn(void* ctx, int target, int* count) {
+    return searchAVL((AVLNode*)ctx, target, count);
+}
+
+int eytzingerSearchFn(void* ctx, int target, int* count) {
+    return searchEytzinger((const Eytzinger*)ctx, target, count);
+}
+
+int bplusSearchFn(void* ctx, int target, int* count) {
+    return searchBPlus((const BPlusTree*)ctx, target, count);
+}
+
+// Batch searches take every target in one call
+typedef void (*BatchSearchFn)(void* ctx, const int targets[], int n, int found[], int counts[]);
+
+void bstBatchFn(void* ctx, const int targets[], int n, int found[], int counts[]) {
+    searchBSTBatch((Node*)ctx, targets, n, found, counts);
+}
+
+void avlBatchFn(void* ctx, const int targets[], int n, int found[], int counts[]) {
+    searchAVLBatch((AVLNode*)ctx, targets, n, found, counts);
+}
+
+// Run every target once; returns the total comparisons and the average
+// wall time per search in *nsPerSearch
+int measureSearches(SearchFn fn, void* ctx, const int targets[], int n, double* nsPerSearch) {
+    int total = 0;
+    long long start = get_time_ns();
+    for (int i = 0; i < n; i++) {
+        int count = 0;
+        fn(ctx, targets[i], &count);
+        total += count;
     }
+    *nsPerSearch = (double)(get_time_ns() - start) / n;
+    return total;
 }
 
-void generateDataset(int data[], int type) {
-    switch(type) {
-        case 1: // Random unique integers 0-10000
-            for (int i = 0; i < 10001; i++) {
-                data[i] = i;
-            }
-            shuffle(data, 10001);
+// measureSearches for a batch API; -1 if the result buffers can't be had
+int measureBatch(BatchSearchFn fn, void* ctx, const int targets[], int n, double* nsPerSearch) {
+    int* found = (int*)malloc(sizeof(int) * n);
+    int* counts = (int*)malloc(sizeof(int) * n);
+    if (found == NULL || counts == NULL) {
+        free(found);
+        free(counts);
+        return -1;
+    }
+    long long start = get_time_ns();
+    fn(ctx, targets, n, found, counts);
+    *nsPerSearch = (double)(get_time_ns() - start) / n;
+
+    int total = 0;
+    for (int i = 0; i < n; i++)
+        total += counts[i];
+    free(found);
+    free(counts);
+    return total;
+}
+
+// ============================================
+// WORKLOAD GENERATOR
+// ============================================
+
+// xoshiro256** PRNG; seeded through splitmix64 so any seed gives a good state
+typedef struct {
+    unsigned long long s[4];
+} Xoshiro;
+
+unsigned long long rotl64(unsigned long long x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+void seedXoshiro(Xoshiro* rng, unsigned long long seed) {
+    for (int i = 0; i < 4; i++) {
+        unsigned long long z = (seed += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        rng->s[i] = z ^ (z >> 31);
+    }
+}
+
+unsigned long long nextXoshiro(Xoshiro* rng) {
+    unsigned long long* s = rng->s;
+    unsigned long long result = rotl64(s[1] * 5, 7) * 9;
+    unsigned long long t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl64(s[3], 45);
+    return result;
+}
+
+// Uniform in [0, bound) for bound < 2^32, without a division
+unsigned int randomBelow(Xoshiro* rng, unsigned int bound) {
+    return (unsigned int)(((nextXoshiro(rng) >> 32) * bound) >> 32);
+}
+
+// Uniform in [0, 1)
+double randomUnit(Xoshiro* rng) {
+    return (double)(nextXoshiro(rng) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Zipf ranks 1..n with P(k) ~ 1/k^s, by rejection-inversion (Hormann and
+// Derflinger): O(1) per sample with no table, so n can be 1e8.
+#define ZIPF_EXPONENT 0.99
+
+typedef struct {
+    double s;
+    int n;
+    double hX1;
+    double hN;
+    double threshold;
+} Zipf;
+
+// (x^(1-s) - 1) / (1-s), the integral of 1/x^s
+double zipfH(double s, double x) {
+    double logX = log(x);
+    double t = (1.0 - s) * logX;
+    return (fabs(t) > 1e-8 ? expm1(t) / t : 1.0 + t / 2.0) * logX;
+}
+
+double zipfHInverse(double s, double x) {
+    double t = x * (1.0 - s);
+    return exp((fabs(t) > 1e-8 ? log1p(t) / t : 1.0 - t / 2.0) * x);
+}
+
+void initZipf(Zipf* z, int n, double s) {
+    z->s = s;
+    z->n = n;
+    z->hX1 = zipfH(s, 1.5) - 1.0;
+    z->hN = zipfH(s, n + 0.5);
+    z->threshold = 2.0 - zipfHInverse(s, zipfH(s, 2.5) - exp(-s * log(2.0)));
+}
+
+int sampleZipf(const Zipf* z, Xoshiro* rng) {
+    for (;;) {
+        double u = z->hN + randomUnit(rng) * (z->hX1 - z->hN);
+        double x = zipfHInverse(z->s, u);
+        int k = (int)(x + 0.5);
+        if (k < 1) k = 1;
+        else if (k > z->n) k = z->n;
+        if (k - x <= z->threshold || u >= zipfH(z->s, k + 0.5) - exp(-z->s * log((double)k)))
+            return k;
+    }
+}
+
+typedef enum {
+    DIST_UNIFORM,    // random values in [0, 4n), duplicates allowed
+    DIST_ZIPF,       // value ranks with Zipf frequencies: few hot keys, long tail
+    DIST_SORTED,     // 0 .. n-1
+    DIST_REVERSE,    // n-1 .. 0
+    DIST_SAWTOOTH,   // ascending runs of SAWTOOTH_PERIOD, each run interleaved
+    DIST_CLUSTERED,  // dense clusters of CLUSTER_SPAN around random centres
+    DIST_COUNT
+} Distribution;
+
+const char* distributionNames[DIST_COUNT] = {
+    "uniform", "zipf", "sorted", "reverse", "sawtooth", "clustered"
+};
+
+#define SAWTOOTH_PERIOD 1000
+#define CLUSTER_SIZE 1024
+#define CLUSTER_SPAN 2048
+
+// n keys on the heap (NULL on failure). Every key is even, so any odd value
+// is a guaranteed miss; see generateTargets. Values stay below
+// 16n + 2*CLUSTER_SPAN, which fits an int up to n = 1e8.
+int* generateDataset(Distribution dist, int n, Xoshiro* rng) {
+    int* data = (int*)malloc(sizeof(int) * (size_t)n);
+    if (data == NULL)
+        return NULL;
+
+    switch (dist) {
+        case DIST_UNIFORM:
+            for (int i = 0; i < n; i++)
+                data[i] = 2 * (int)randomBelow(rng, 4u * (unsigned int)n);
             break;
-        case 2: // Sorted 0-999
-            for (int i = 0; i < 1000; i++) {
-                data[i] = i;
-            }
+        case DIST_ZIPF: {
+            Zipf z;
+            initZipf(&z, n, ZIPF_EXPONENT);
+            for (int i = 0; i < n; i++)
+                data[i] = 2 * (sampleZipf(&z, rng) - 1);
             break;
-        case 3: // Sorted 999-0
-            for (int i = 0; i < 1000; i++) {
-                data[i] = 999 - i;
-            }
+        }
+        case DIST_SORTED:
+            for (int i = 0; i < n; i++)
+                data[i] = 2 * i;
             break;
-        case 4: // i * (i % 2 + 2)
-            for (int i = 0; i < 1000; i++) {
-                data[i] = i * (i % 2 + 2);
+        case DIST_REVERSE:
+            for (int i = 0; i < n; i++)
+                data[i] = 2 * (n - 1 - i);
+            break;
+        case DIST_SAWTOOTH: {
+            // Run r holds r, r + runs, r + 2*runs, ...: unique, and each
+            // run climbs across the whole key range
+            int runs = (n + SAWTOOTH_PERIOD - 1) / SAWTOOTH_PERIOD;
+            for (int i = 0; i < n; i++)
+                data[i] = 2 * ((i % SAWTOOTH_PERIOD) * runs + i / SAWTOOTH_PERIOD);
+            break;
+        }
+        case DIST_CLUSTERED: {
+            int clusters = n / CLUSTER_SIZE > 0 ? n / CLUSTER_SIZE : 1;
+            int* centers = (int*)malloc(sizeof(int) * clusters);
+            if (centers == NULL) {
+                free(data);
+                return NULL;
             }
+            for (int c = 0; c < clusters; c++)
+                centers[c] = (int)randomBelow(rng, 8u * (unsigned int)n);
+            for (int i = 0; i < n; i++)
+                data[i] = 2 * (centers[randomBelow(rng, clusters)] + (int)randomBelow(rng, CLUSTER_SPAN));
+            free(centers);
+            break;
+        }
+        default:
             break;
     }
+    return data;
 }
 
-void runTest(int datasetType, const char* datasetName) {
-    int data[10001];
-    int searchTargets[1000];
-    
-    generateDataset(data, datasetType);
-    
-    int* arr = (int*)malloc(1000 * sizeof(int));
-    Node* bstRoot = NULL;
-    AVLNode* avlRoot = NULL;
-    
-    for (int i = 0; i < 1000; i++) {
-        arr[i] = data[i];
-        bstRoot = insertBST(bstRoot, data[i]);
-        avlRoot = insertAVL(avlRoot, data[i]);
+// Hits are stored keys picked uniformly by position (so they follow the key
+// distribution); misses are odd values between the smallest and largest key
+void generateTargets(const int keys[], int n, int targets[], int numTargets,
+                     double hitRatio, Xoshiro* rng) {
+    int minKey = keys[0], maxKey = keys[0];
+    for (int i = 1; i < n; i++) {
+        if (keys[i] < minKey) minKey = keys[i];
+        if (keys[i] > maxKey) maxKey = keys[i];
     }
-    
-    for (int i = 0; i < 1000; i++) {
-        searchTargets[i] = rand() % 10001;
+    unsigned int missRange = (unsigned int)(maxKey - minKey) / 2 + 1;
+
+    for (int i = 0; i < numTargets; i++) {
+        if (randomUnit(rng) < hitRatio)
+            targets[i] = keys[randomBelow(rng, (unsigned int)n)];
+        else
+            targets[i] = minKey + 1 + 2 * (int)randomBelow(rng, missRange);
     }
-    
-    int totalArrayCount = 0;
-    int totalBSTCount = 0;
-    int totalAVLCount = 0;
-    
-    for (int i = 0; i < 1000; i++) {
-        int count = 0;
-        linearSearch(arr, 1000, searchTargets[i], &count);
-        totalArrayCount += count;
-        
-        count = 0;
-        searchBST(bstRoot, searchTargets[i], &count);
-        totalBSTCount += count;
-        
-        count = 0;
-        searchAVL(avlRoot, searchTargets[i], &count);
-        totalAVLCount += count;
+}
+
+// ============================================
+// TEST DRIVER
+// ============================================
+
+#define SEARCH_TARGETS 1000
+#define RANGE_QUERIES 100
+#define RANGE_KEYS 64       // keys per range scan (fewer near the top)
+#define MAX_DATASET_SIZE 100000000
+#define DEFAULT_MAX_SIZE 100000
+#define DEFAULT_HIT_RATIO 0.5
+
+// The unbalanced structures are quadratic to build or search at scale;
+// larger runs skip them and print "-" instead
+#define LINEAR_MAX_SIZE 100000
+#define BST_MAX_SIZE 10000
+
+typedef struct {
+    Distribution dist;
+    int n;
+    double hitRatio;
+    unsigned long long seed;
+} Workload;
+
+void printResult(const char* structure, const char* datasetName, int totalCount, double ns) {
+    printf("%s: %s에서 평균 %.2f회 탐색 (%.1f ns)\n",
+           structure, datasetName, (double)totalCount / SEARCH_TARGETS, ns);
+}
+
+void printSkipped(const char* structure, const char* datasetName) {
+    printf("%s: %s에서 -\n", structure, datasetName);
+}
+
+// Scan RANGE_QUERIES ranges of up to RANGE_KEYS keys, each starting at a
+// random stored key, and check every result against the sorted keys.
+// Returns the average keys per scan, -1 on a mismatch or -2 if memory ran
+// out; the time per scan goes to *nsPerScan.
+double measureRanges(const BPlusTree* tree, const int data[], int n, Xoshiro* rng, double* nsPerScan) {
+    int* sorted = (int*)malloc(sizeof(int) * (size_t)n);
+    int* results = (int*)malloc(sizeof(int) * RANGE_QUERIES * RANGE_KEYS);
+    if (sorted == NULL || results == NULL) {
+        free(sorted);
+        free(results);
+        return -2.0;
     }
-    
-    printf("Array: %s에서 평균 %.2f회 탐색\n", 
-           datasetName, totalArrayCount / 1000.0);
-    printf("BST: %s에서 평균 %.2f회 탐색\n", 
-           datasetName, totalBSTCount / 1000.0);
-    printf("AVL: %s에서 평균 %.2f회 탐색\n\n", 
-           datasetName, totalAVLCount / 1000.0);
-    
-    free(arr);
-    freeBST(bstRoot);
+
+    for (int i = 0; i < n; i++) sorted[i] = data[i];
+    qsort(sorted, n, sizeof(int), compareInt);
+    int unique = 0;
+    for (int i = 0; i < n; i++) {
+        if (unique == 0 || sorted[i] != sorted[unique - 1])
+            sorted[unique++] = sorted[i];
+    }
+
+    int firsts[RANGE_QUERIES], lasts[RANGE_QUERIES], counts[RANGE_QUERIES];
+    for (int q = 0; q < RANGE_QUERIES; q++) {
+        firsts[q] = (int)randomBelow(rng, (unsigned int)unique);
+        lasts[q] = firsts[q] + RANGE_KEYS - 1 < unique ? firsts[q] + RANGE_KEYS - 1 : unique - 1;
+    }
+
+    long long start = get_time_ns();
+    for (int q = 0; q < RANGE_QUERIES; q++)
+        counts[q] = rangeBPlus(tree, sorted[firsts[q]], sorted[lasts[q]],
+                               results + q * RANGE_KEYS, RANGE_KEYS);
+    *nsPerScan = (double)(get_time_ns() - start) / RANGE_QUERIES;
+
+    long long totalKeys = 0;
+    int matches = 1;
+    for (int q = 0; q < RANGE_QUERIES; q++) {
+        if (counts[q] != lasts[q] - firsts[q] + 1 ||
+            memcmp(results + q * RANGE_KEYS, sorted + firsts[q], sizeof(int) * counts[q]) != 0)
+            matches = 0;
+        totalKeys += counts[q];
+    }
+
+    free(sorted);
+    free(results);
+    return matches ? (double)totalKeys / RANGE_QUERIES : -1.0;
+}
+
+void runTest(const Workload* w) {
+    char datasetName[96];
+    snprintf(datasetName, sizeof(datasetName), "%s n=%d hit=%.0f%%",
+             distributionNames[w->dist], w->n, w->hitRatio * 100.0);
+
+    Xoshiro rng;
+    seedXoshiro(&rng, w->seed);
+    int* data = generateDataset(w->dist, w->n, &rng);
+    int* searchTargets = (int*)malloc(sizeof(int) * SEARCH_TARGETS);
+    if (data == NULL || searchTargets == NULL) {
+        printf("%s: 메모리 할당 실패\n\n", datasetName);
+        free(data);
+        free(searchTargets);
+        return;
+    }
+    generateTargets(data, w->n, searchTargets, SEARCH_TARGETS, w->hitRatio, &rng);
+
+    int n = w->n;
+    int total;
+    double ns;
+
+    if (n <= LINEAR_MAX_SIZE) {
+        ArrayCtx arrCtx = { data, n };
+        total = measureSearches(linearSearchFn, &arrCtx, searchTargets, SEARCH_TARGETS, &ns);
+        printResult("Array", datasetName, total, ns);
+        total = measureSearches(linearSearchSIMDFn, &arrCtx, searchTargets, SEARCH_TARGETS, &ns);
+        printResult("Array (SIMD)", datasetName, total, ns);
+    } else {
+        printSkipped("Array", datasetName);
+        printSkipped("Array (SIMD)", datasetName);
+    }
+
+    if (n <= BST_MAX_SIZE) {
+        Node* bstRoot = NULL;
+        for (int i = 0; i < n; i++)
+            bstRoot = insertBST(bstRoot, data[i]);
+        total = measureSearches(bstSearchFn, bstRoot, searchTargets, SEARCH_TARGETS, &ns);
+        printResult("BST", datasetName, total, ns);
+        total = measureBatch(bstBatchFn, bstRoot, searchTargets, SEARCH_TARGETS, &ns);
+        printResult("BST (batch)", datasetName, total, ns);
+        freeBST(bstRoot);
+    } else {
+        printSkipped("BST", datasetName);
+        printSkipped("BST (batch)", datasetName);
+    }
+
+    // Sorted input is bulk-loaded in O(n); anything else is inserted
+    AVLNode* avlRoot = NULL;
+    AVLNode* avlPool = NULL;
+    int order = sortedOrder(data, n);
+    long long buildStart = get_time_ns();
+    if (order != 0)
+        avlRoot = buildAVLSorted(data, n, order < 0, &avlPool);
+    if (avlRoot == NULL) {
+        for (int i = 0; i < n; i++)
+            avlRoot = insertAVL(avlRoot, data[i]);
+    }
+    double buildMs = (double)(get_time_ns() - buildStart) / 1e6;
+    total = measureSearches(avlSearchFn, avlRoot, searchTargets, SEARCH_TARGETS, &ns);
+    printResult("AVL", datasetName, total, ns);
+    total = measureBatch(avlBatchFn, avlRoot, searchTargets, SEARCH_TARGETS, &ns);
+    printResult("AVL (batch)", datasetName, total, ns);
+    printf("AVL build: %s에서 %.2f ms (%s)\n", datasetName, buildMs,
+           avlPool != NULL ? "bulk" : "insert");
     freeAVL(avlRoot);
+    free(avlPool);
+
+    Eytzinger* eytzinger = buildEytzinger(data, n);
+    if (eytzinger != NULL) {
+        total = measureSearches(eytzingerSearchFn, eytzinger, searchTargets, SEARCH_TARGETS, &ns);
+        printResult("Eytzinger", datasetName, total, ns);
+        freeEytzinger(eytzinger);
+    } else {
+        printSkipped("Eytzinger", datasetName);
+    }
+
+    BPlusTree bplus = { 0 };
+    int bplusStatus = 0;
+    for (int i = 0; i < n && bplusStatus >= 0; i++)
+        bplusStatus = insertBPlus(&bplus, data[i]);
+    if (bplusStatus >= 0) {
+        // One B+ tree "comparison" is a 16-key vector compare in one node
+        total = measureSearches(bplusSearchFn, &bplus, searchTargets, SEARCH_TARGETS, &ns);
+        printResult("B+Tree", datasetName, total, ns);
+
+        double keysPerScan = measureRanges(&bplus, data, n, &rng, &ns);
+        if (keysPerScan >= 0.0)
+            printf("B+Tree (range): %s에서 평균 %.1f개 키 (%.1f ns, 정렬 배열과 일치)\n",
+                   datasetName, keysPerScan, ns);
+        else if (keysPerScan == -1.0)
+            printf("B+Tree (range): %s에서 정렬 배열과 불일치\n", datasetName);
+        else
+            printf("B+Tree (range): %s에서 메모리 할당 실패\n", datasetName);
+    } else {
+        printf("B+Tree: %s에서 메모리 할당 실패\n", datasetName);
+    }
+    freeBPlus(&bplus);
+    printf("\n");
+
+    free(data);
+    free(searchTargets);
 }
 
 // ============================================
 // MAIN FUNCTION
 // ============================================
 
-int main() {
-    srand((unsigned)time(NULL));
-    
-    printf("=== Search Performance Comparison ===\n\n");
-    
-    runTest(1, "데이터 (1)");
-    runTest(2, "데이터 (2)");
-    runTest(3, "데이터 (3)");
-    runTest(4, "데이터 (4)");
-    
+// Usage: main [maxSize] [hitRatio] [seed]
+// Sweeps every distribution over sizes 1e3, 1e4, ... up to maxSize
+// (default 1e5, at most 1e8). The same seed reproduces the same run.
+int main(int argc, char* argv[]) {
+    long long maxSize = argc > 1 ? atoll(argv[1]) : DEFAULT_MAX_SIZE;
+    double hitRatio = argc > 2 ? atof(argv[2]) : DEFAULT_HIT_RATIO;
+    unsigned long long seed = argc > 3 ? strtoull(argv[3], NULL, 10) : (unsigned long long)time(NULL);
+
+    if (maxSize < 1000 || maxSize > MAX_DATASET_SIZE || hitRatio < 0.0 || hitRatio > 1.0) {
+        fprintf(stderr, "Usage: %s [maxSize 1000..%d] [hitRatio 0..1] [seed]\n",
+                argv[0], MAX_DATASET_SIZE);
+        return 1;
+    }
+
+    bplusRankKernel = resolveBPlusRank();
+
+    printf("=== Search Performance Comparison (seed %llu) ===\n\n", seed);
+
+    for (int d = 0; d < DIST_COUNT; d++) {
+        for (long long n = 1000; n <= maxSize; n *= 10) {
+            Workload w = { (Distribution)d, (int)n, hitRatio, seed };
+            runTest(&w);
+        }
+    }
+
     return 0;
-}
\ No newline at end of file
+}
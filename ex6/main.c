@@ -2,93 +2,277 @@
 #include <stdlib.h>
 #include <time.h>
 #include <string.h> 
+#include <stdint.h>
+#include <math.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define HAVE_X86_DISPATCH 1
+#endif
 
 #define MAX_VERTICES 100    
 #define SPARSE_EDGES 100   
 #define DENSE_EDGES 4000   
+#define BENCH_QUERIES 100000
+#define BENCH_ROUNDS 1000
+#define LARGE_VERTICES (1 << 20)
+#define LARGE_EDGES 4000000
 
 // ==================== 자료구조 정의 ====================
 
+// 비트 인접 행렬: 간선 하나에 1비트, 한 워드에 정점 64개.
+// 정점 v의 행은 rows[v * words_per_row ..] 이다
 typedef struct {
-    int matrix[MAX_VERTICES][MAX_VERTICES];
+    uint64_t* rows;
     int num_vertices;
+    int words_per_row;
 } AdjMatrix;
 
-typedef struct Node {
-    int vertex;
-    struct Node* next;
-} Node;
+// 정점마다 이웃을 연속 배열에 담는다 (추가는 분할 상환 O(1), 삭제는
+// 마지막 원소와 자리를 바꾸는 O(1) swap-remove)
+typedef struct {
+    int* items;
+    int count;
+    int capacity;
+} NeighborArray;
+
+// 간선 색인: 방향 간선 키 (src, dest) -> src의 이웃 배열에서 dest의 위치.
+// 열린 주소 해시 (선형 탐사, 부하율 1/2 이하), 빈 칸은 EDGE_EMPTY
+typedef struct {
+    uint64_t* keys;
+    int* positions;
+    size_t capacity;
+    size_t count;
+} EdgeIndex;
 
 typedef struct {
-    Node** array;
+    NeighborArray* array;
     int num_vertices;
+    size_t memory;      // 할당한 바이트 수, 할당/재할당마다 갱신 (색인 제외)
+    EdgeIndex* index;   // 선택 사항: NULL이면 배열을 훑는다
 } AdjList;
 
+// 불변 CSR: 정점 v의 이웃은 neighbors[offsets[v] .. offsets[v+1]) 구간에
+// 오름차순으로 연속 저장된다
+typedef struct {
+    int* offsets;    // num_vertices + 1
+    int* neighbors;  // 2 * num_edges (무방향 간선을 양쪽에 저장)
+    int num_vertices;
+    int num_edges;
+} CSRGraph;
+
+// ==================== 간선 해시 색인 ====================
+
+#define EDGE_EMPTY UINT64_MAX
+
+// 간선 (src, dest)를 64비트 키 하나로 묶는다
+static uint64_t pack_edge(int src, int dest) {
+    return ((uint64_t)(uint32_t)src << 32) | (uint32_t)dest;
+}
+
+static size_t edge_hash(uint64_t key, size_t capacity) {
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33;
+    key *= 0xC4CEB9FE1A85EC53ULL;
+    key ^= key >> 33;
+    return (size_t)key & (capacity - 1);
+}
+
+int edge_index_init(EdgeIndex* index, size_t expected) {
+    size_t capacity = 16;
+    while (capacity < expected * 2) capacity <<= 1;
+    index->keys = (uint64_t*)malloc(sizeof(uint64_t) * capacity);
+    index->positions = (int*)malloc(sizeof(int) * capacity);
+    if (!index->keys || !index->positions) {
+        free(index->keys);
+        free(index->positions);
+        return 0;
+    }
+    memset(index->keys, 0xFF, sizeof(uint64_t) * capacity);
+    index->capacity = capacity;
+    index->count = 0;
+    return 1;
+}
+
+void edge_index_free(EdgeIndex* index) {
+    free(index->keys);
+    free(index->positions);
+}
+
+size_t edge_index_memory(const EdgeIndex* index) {
+    return sizeof(EdgeIndex) + index->capacity * (sizeof(uint64_t) + sizeof(int));
+}
+
+// 키가 있는 칸 또는 넣을 빈 칸; *probes에 비교한 칸 수를 더한다
+static size_t edge_index_slot(const EdgeIndex* index, uint64_t key, int* probes) {
+    size_t i = edge_hash(key, index->capacity);
+    for (;;) {
+        (*probes)++;
+        if (index->keys[i] == key || index->keys[i] == EDGE_EMPTY) return i;
+        i = (i + 1) & (index->capacity - 1);
+    }
+}
+
+// 위치 또는 -1
+int edge_index_find(const EdgeIndex* index, uint64_t key, int* probes) {
+    size_t i = edge_index_slot(index, key, probes);
+    return index->keys[i] == key ? index->positions[i] : -1;
+}
+
+// 넣거나 위치를 고친다; 메모리 부족이면 0
+int edge_index_put(EdgeIndex* index, uint64_t key, int position) {
+    int probes = 0;
+    if ((index->count + 1) * 2 > index->capacity) {
+        EdgeIndex bigger;
+        if (!edge_index_init(&bigger, index->capacity)) return 0;
+        for (size_t i = 0; i < index->capacity; i++) {
+            if (index->keys[i] == EDGE_EMPTY) continue;
+            size_t j = edge_index_slot(&bigger, index->keys[i], &probes);
+            bigger.keys[j] = index->keys[i];
+            bigger.positions[j] = index->positions[i];
+        }
+        bigger.count = index->count;
+        edge_index_free(index);
+        *index = bigger;
+    }
+    size_t i = edge_index_slot(index, key, &probes);
+    if (index->keys[i] == EDGE_EMPTY) {
+        index->keys[i] = key;
+        index->count++;
+    }
+    index->positions[i] = position;
+    return 1;
+}
+
+// 지운 칸 뒤의 항목을 당겨 채워 (backward shift) 묘비 없이 탐사열을 유지한다
+void edge_index_remove(EdgeIndex* index, uint64_t key) {
+    int probes = 0;
+    size_t mask = index->capacity - 1;
+    size_t hole = edge_index_slot(index, key, &probes);
+    if (index->keys[hole] == EDGE_EMPTY) return;
+    index->count--;
+
+    size_t i = hole;
+    for (;;) {
+        i = (i + 1) & mask;
+        if (index->keys[i] == EDGE_EMPTY) break;
+        size_t home = edge_hash(index->keys[i], index->capacity);
+        // home이 (hole, i] 구간 밖이면 hole로 옮겨도 탐사열이 이어진다
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            index->keys[hole] = index->keys[i];
+            index->positions[hole] = index->positions[i];
+            hole = i;
+        }
+    }
+    index->keys[hole] = EDGE_EMPTY;
+}
+
 // ==================== 생성 및 해제 함수 ====================
 
 AdjMatrix* create_adj_matrix(int vertices) {
     AdjMatrix* graph = (AdjMatrix*)malloc(sizeof(AdjMatrix));
     if (!graph) return NULL;
     graph->num_vertices = vertices;
-    memset(graph->matrix, 0, sizeof(graph->matrix));
+    graph->words_per_row = (vertices + 63) / 64;
+    graph->rows = (uint64_t*)calloc((size_t)vertices * graph->words_per_row, sizeof(uint64_t));
+    if (!graph->rows) {
+        free(graph);
+        return NULL;
+    }
     return graph;
 }
 
+void free_adj_matrix(AdjMatrix* graph) {
+    if (!graph) return;
+    free(graph->rows);
+    free(graph);
+}
+
 AdjList* create_adj_list(int vertices) {
     AdjList* graph = (AdjList*)malloc(sizeof(AdjList));
     if (!graph) return NULL;
     graph->num_vertices = vertices;
-    graph->array = (Node**)malloc(vertices * sizeof(Node*));
+    graph->array = (NeighborArray*)calloc(vertices, sizeof(NeighborArray));
     if (!graph->array) {
         free(graph);
         return NULL;
     }
-    for (int i = 0; i < vertices; i++) {
-        graph->array[i] = NULL;
-    }
+    graph->memory = sizeof(AdjList) + vertices * sizeof(NeighborArray);
+    graph->index = NULL;
     return graph;
 }
 
-Node* create_node(int vertex) {
-    Node* new_node = (Node*)malloc(sizeof(Node));
-    if (!new_node) return NULL;
-    new_node->vertex = vertex;
-    new_node->next = NULL;
-    return new_node;
-}
-
 void free_adj_list(AdjList* graph) {
     if (!graph) return;
     for(int i = 0; i < graph->num_vertices; i++) {
-        Node* temp = graph->array[i];
-        while(temp) {
-            Node* to_free = temp;
-            temp = temp->next;
-            free(to_free);
-        }
+        free(graph->array[i].items);
+    }
+    if (graph->index) {
+        edge_index_free(graph->index);
+        free(graph->index);
     }
     free(graph->array);
     free(graph);
 }
 
+// 이미 들어 있는 간선으로 색인을 만들어 붙인다. 이후 삽입/삭제가 색인을
+// 함께 고치고, 연결 확인과 삭제 위치 찾기가 O(1) 기대 시간이 된다.
+// 실패하면 0 (그래프는 색인 없이 그대로 동작)
+int list_enable_edge_index(AdjList* graph) {
+    if (graph->index) return 1;
+    size_t entries = 0;
+    for (int v = 0; v < graph->num_vertices; v++) entries += graph->array[v].count;
+
+    EdgeIndex* index = (EdgeIndex*)malloc(sizeof(EdgeIndex));
+    if (!index) return 0;
+    if (!edge_index_init(index, entries)) {
+        free(index);
+        return 0;
+    }
+    for (int v = 0; v < graph->num_vertices; v++) {
+        for (int k = 0; k < graph->array[v].count; k++) {
+            if (!edge_index_put(index, pack_edge(v, graph->array[v].items[k]), k)) {
+                edge_index_free(index);
+                free(index);
+                return 0;
+            }
+        }
+    }
+    graph->index = index;
+    return 1;
+}
+
 // ==================== 인접 행렬 연산 및 비교 횟수 측정 ====================
 
+static uint64_t* matrix_row(AdjMatrix* graph, int vertex) {
+    return graph->rows + (size_t)vertex * graph->words_per_row;
+}
+
 int matrix_add_edge(AdjMatrix* graph, int src, int dest) {
     if (src >= 0 && src < graph->num_vertices && dest >= 0 && dest < graph->num_vertices) {
-        graph->matrix[src][dest] = 1;
-        graph->matrix[dest][src] = 1;
+        matrix_row(graph, src)[dest >> 6] |= 1ULL << (dest & 63);
+        matrix_row(graph, dest)[src >> 6] |= 1ULL << (src & 63);
     }
     return 1;
 }
 
 int matrix_remove_edge(AdjMatrix* graph, int src, int dest) {
     if (src >= 0 && src < graph->num_vertices && dest >= 0 && dest < graph->num_vertices) {
-        graph->matrix[src][dest] = 0;
-        graph->matrix[dest][src] = 0;
+        matrix_row(graph, src)[dest >> 6] &= ~(1ULL << (dest & 63));
+        matrix_row(graph, dest)[src >> 6] &= ~(1ULL << (src & 63));
     }
     return 1;
 }
 
+int matrix_has_edge(AdjMatrix* graph, int src, int dest) {
+    return (int)((matrix_row(graph, src)[dest >> 6] >> (dest & 63)) & 1);
+}
+
 int matrix_is_connected(AdjMatrix* graph, int src, int dest) {
     int comparison_count = 1; 
     if (src >= 0 && src < graph->num_vertices && dest >= 0 && dest < graph->num_vertices) {
@@ -97,69 +281,201 @@ int matrix_is_connected(AdjMatrix* graph, int src, int dest) {
     return comparison_count;
 }
 
+// 이웃 열거: 0이 아닌 워드에서 tzcnt로 켜진 비트만 꺼낸다.
+// out에 이웃을 오름차순으로 쓰고 개수를 돌려준다 (out은 NULL 가능)
+int matrix_neighbors(AdjMatrix* graph, int vertex, int* out) {
+    const uint64_t* row = matrix_row(graph, vertex);
+    int count = 0;
+    for (int w = 0; w < graph->words_per_row; w++) {
+        uint64_t bits = row[w];
+        while (bits) {
+            if (out) out[count] = w * 64 + __builtin_ctzll(bits);
+            count++;
+            bits &= bits - 1;
+        }
+    }
+    return count;
+}
+
+// 워드 단위 비교 1번 + 찾은 이웃마다 1번
 int matrix_print_neighbors(AdjMatrix* graph, int vertex) {
     int comparison_count = 1;
     if (vertex >= 0 && vertex < graph->num_vertices) {
-        for (int i = 0; i < graph->num_vertices; i++) {
-            comparison_count++; 
-            comparison_count++; //
-        }
+        comparison_count += graph->words_per_row;
+        comparison_count += matrix_neighbors(graph, vertex, NULL);
     }
     return comparison_count;
 }
 
+// 두 행의 popcount(a AND b). AVX2는 바이트를 니블로 나눠 pshufb 표로 세고
+// (Mula) sad_epu8로 더한다; 네 워드보다 짧은 나머지는 스칼라로 센다
+static int popcount_and_scalar(const uint64_t* a, const uint64_t* b, int words) {
+    int count = 0;
+    for (int w = 0; w < words; w++) {
+        count += __builtin_popcountll(a[w] & b[w]);
+    }
+    return count;
+}
+
+#ifdef HAVE_X86_DISPATCH
+__attribute__((target("popcnt")))
+static int popcount_and_popcnt(const uint64_t* a, const uint64_t* b, int words) {
+    int count = 0;
+    for (int w = 0; w < words; w++) {
+        count += __builtin_popcountll(a[w] & b[w]);
+    }
+    return count;
+}
+
+__attribute__((target("avx2,popcnt")))
+static int popcount_and_avx2(const uint64_t* a, const uint64_t* b, int words) {
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+    __m256i total = _mm256_setzero_si256();
+    int w = 0;
+    for (; w + 4 <= words; w += 4) {
+        __m256i v = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(a + w)),
+                                     _mm256_loadu_si256((const __m256i*)(b + w)));
+        __m256i lo = _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, low_mask));
+        __m256i hi = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask));
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256()));
+    }
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, total);
+    int count = (int)(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    for (; w < words; w++) {
+        count += __builtin_popcountll(a[w] & b[w]);
+    }
+    return count;
+}
+#endif
+
+typedef int (*PopcountAndFn)(const uint64_t* a, const uint64_t* b, int words);
+
+static PopcountAndFn resolve_popcount_and(void) {
+#ifdef HAVE_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt"))
+        return popcount_and_avx2;
+    if (__builtin_cpu_supports("popcnt"))
+        return popcount_and_popcnt;
+#endif
+    return popcount_and_scalar;
+}
+
+static int popcount_and(const uint64_t* a, const uint64_t* b, int words) {
+    static PopcountAndFn fn = NULL;
+    if (!fn) fn = resolve_popcount_and();
+    return fn(a, b, words);
+}
+
+int matrix_degree(AdjMatrix* graph, int vertex) {
+    if (vertex < 0 || vertex >= graph->num_vertices) return 0;
+    const uint64_t* row = matrix_row(graph, vertex);
+    return popcount_and(row, row, graph->words_per_row);
+}
+
+int matrix_common_neighbors(AdjMatrix* graph, int a, int b) {
+    if (a < 0 || a >= graph->num_vertices || b < 0 || b >= graph->num_vertices) return 0;
+    return popcount_and(matrix_row(graph, a), matrix_row(graph, b), graph->words_per_row);
+}
+
 size_t matrix_memory_usage(AdjMatrix* graph) {
-    return sizeof(AdjMatrix);
+    return sizeof(AdjMatrix) + (size_t)graph->num_vertices * graph->words_per_row * sizeof(uint64_t);
 }
 
 
 // ==================== 인접 리스트 연산 및 비교 횟수 측정 ====================
 
+// 용량이 차면 두 배로 늘린다; 실패하면 0
+static int neighbor_append(AdjList* graph, NeighborArray* list, int vertex) {
+    if (list->count == list->capacity) {
+        int new_capacity = list->capacity ? list->capacity * 2 : 4;
+        int* temp = (int*)realloc(list->items, sizeof(int) * new_capacity);
+        if (!temp) return 0;
+        graph->memory += sizeof(int) * (size_t)(new_capacity - list->capacity);
+        list->items = temp;
+        list->capacity = new_capacity;
+    }
+    list->items[list->count++] = vertex;
+    return 1;
+}
+
+// 색인이 있으면 두 방향 키를 함께 넣는다 (이미 있는 간선은 다시 넣지 않는다)
+static void list_add_indexed(AdjList* graph, int src, int dest) {
+    int probes = 0;
+    NeighborArray* src_list = &graph->array[src];
+    NeighborArray* dest_list = &graph->array[dest];
+    if (edge_index_find(graph->index, pack_edge(src, dest), &probes) >= 0) return;
+    if (!neighbor_append(graph, src_list, dest)) return;
+    if (!neighbor_append(graph, dest_list, src)) {
+        src_list->count--;
+        return;
+    }
+    if (!edge_index_put(graph->index, pack_edge(src, dest), src_list->count - 1) ||
+        !edge_index_put(graph->index, pack_edge(dest, src), dest_list->count - 1)) {
+        edge_index_remove(graph->index, pack_edge(src, dest));
+        src_list->count--;
+        dest_list->count--;
+    }
+}
+
 int list_add_edge(AdjList* graph, int src, int dest) {
     int comparison_count = 1; 
     if (src >= 0 && src < graph->num_vertices && dest >= 0 && dest < graph->num_vertices) {
-        Node* new_node_dest = create_node(dest);
-        Node* new_node_src = create_node(src);
-        
-        if (new_node_dest) {
-            new_node_dest->next = graph->array[src];
-            graph->array[src] = new_node_dest;
-        }
-
-        if (new_node_src) {
-            new_node_src->next = graph->array[dest];
-            graph->array[dest] = new_node_src;
+        if (graph->index) {
+            list_add_indexed(graph, src, dest);
+        } else if (neighbor_append(graph, &graph->array[src], dest)) {
+            if (!neighbor_append(graph, &graph->array[dest], src)) {
+                graph->array[src].count--;
+            }
         }
     }
     return comparison_count;
 }
 
-int remove_node_from_list(Node** head_ref, int target) {
-    Node* temp = *head_ref;
-    Node* prev = NULL;
+// 배열에서 target을 찾아 마지막 원소로 덮는다
+int remove_node_from_list(NeighborArray* list, int target) {
     int count = 0;
-    while (temp != NULL) {
+    for (int i = 0; i < list->count; i++) {
         count++; 
         count++; 
-        if (temp->vertex == target) {
+        if (list->items[i] == target) {
             count++; 
-            if (prev == NULL)
-                *head_ref = temp->next;
-            else
-                prev->next = temp->next;
-            free(temp);
+            list->items[i] = list->items[--list->count];
             return count; 
         }
-        prev = temp;
-        temp = temp->next;
     }
     count++; 
     return count; 
 }
 
+// 색인으로 위치를 바로 찾아 swap-remove하고, 자리를 옮긴 이웃의 위치를
+// 고친다. 비교 횟수는 해시에서 비교한 칸 수다.
+static int remove_indexed(EdgeIndex* index, NeighborArray* list, int owner, int target) {
+    int probes = 0;
+    uint64_t key = pack_edge(owner, target);
+    int position = edge_index_find(index, key, &probes);
+    if (position < 0) return probes;
+
+    int moved = list->items[--list->count];
+    if (position != list->count) {
+        list->items[position] = moved;
+        edge_index_put(index, pack_edge(owner, moved), position);
+    }
+    edge_index_remove(index, key);
+    return probes;
+}
+
 int list_remove_edge(AdjList* graph, int src, int dest) {
     int comparison_count = 1;
     if (src >= 0 && src < graph->num_vertices && dest >= 0 && dest < graph->num_vertices) {
+        if (graph->index) {
+            comparison_count += remove_indexed(graph->index, &graph->array[src], src, dest);
+            comparison_count += remove_indexed(graph->index, &graph->array[dest], dest, src);
+            return comparison_count;
+        }
         comparison_count += remove_node_from_list(&graph->array[src], dest);
         comparison_count += remove_node_from_list(&graph->array[dest], src);
     }
@@ -169,16 +485,17 @@ int list_remove_edge(AdjList* graph, int src, int dest) {
 int list_is_connected(AdjList* graph, int src, int dest, int* out_comparison) {
     int comparison_count = 1; 
     int is_connected = 0;
-    if (src >= 0 && src < graph->num_vertices && dest >= 0 && dest < graph->num_vertices) {
-        Node* temp = graph->array[src];
-        while (temp != NULL) {
+    if (src >= 0 && src < graph->num_vertices && dest >= 0 && dest < graph->num_vertices && graph->index) {
+        is_connected = edge_index_find(graph->index, pack_edge(src, dest), &comparison_count) >= 0;
+    } else if (src >= 0 && src < graph->num_vertices && dest >= 0 && dest < graph->num_vertices) {
+        const NeighborArray* list = &graph->array[src];
+        for (int i = 0; i < list->count; i++) {
             comparison_count++; 
             comparison_count++; 
-            if (temp->vertex == dest) {
+            if (list->items[i] == dest) {
                 is_connected = 1;
                 break;
             }
-            temp = temp->next;
         }
         comparison_count++; 
     }
@@ -189,59 +506,581 @@ int list_is_connected(AdjList* graph, int src, int dest, int* out_comparison) {
 void list_print_neighbors(AdjList* graph, int vertex, int* out_comparison) {
     int comparison_count = 1; 
     if (vertex >= 0 && vertex < graph->num_vertices) {
-        Node* temp = graph->array[vertex];
-        while (temp != NULL) {
-            comparison_count++; 
-            temp = temp->next;
-        }
+        comparison_count += graph->array[vertex].count;
         comparison_count++; 
     }
     *out_comparison = comparison_count;
 }
 
+// 할당할 때마다 갱신해 둔 값이라 O(1)
 size_t list_memory_usage(AdjList* graph) {
-    size_t total = sizeof(AdjList); 
-    total += graph->num_vertices * sizeof(Node*); 
-
-    for (int i = 0; i < graph->num_vertices; i++) {
-        Node* temp = graph->array[i];
-        while (temp != NULL) {
-            total += sizeof(Node);
-            temp = temp->next;
+    return graph->memory + (graph->index ? edge_index_memory(graph->index) : 0);
+}
+
+// ==================== CSR 생성, 연산 및 비교 횟수 측정 ====================
+
+// 중복 없는 무방향 간선 목록에서 O(V+E)로 생성한다. 먼저 차수를 세어
+// offsets를 만들고 정렬되지 않은 행을 채운 뒤, 정점 v = 0, 1, ... 순서로
+// 각 이웃 u의 행에 v를 덧붙이면 모든 행이 비교 정렬 없이 오름차순이 된다.
+CSRGraph* create_csr(int vertices, int num_edges, int edges[][2]) {
+    CSRGraph* graph = (CSRGraph*)malloc(sizeof(CSRGraph));
+    if (!graph) return NULL;
+    graph->num_vertices = vertices;
+    graph->num_edges = num_edges;
+    graph->offsets = (int*)calloc((size_t)vertices + 1, sizeof(int));
+    graph->neighbors = (int*)malloc(sizeof(int) * 2 * (size_t)num_edges);
+    int* unsorted = (int*)malloc(sizeof(int) * 2 * (size_t)num_edges);
+    int* fill = (int*)malloc(sizeof(int) * ((size_t)vertices + 1));
+    if (!graph->offsets || !graph->neighbors || !unsorted || !fill) {
+        free(graph->offsets);
+        free(graph->neighbors);
+        free(unsorted);
+        free(fill);
+        free(graph);
+        return NULL;
+    }
+
+    for (int i = 0; i < num_edges; i++) {
+        graph->offsets[edges[i][0] + 1]++;
+        graph->offsets[edges[i][1] + 1]++;
+    }
+    for (int v = 0; v < vertices; v++) {
+        graph->offsets[v + 1] += graph->offsets[v];
+    }
+
+    memcpy(fill, graph->offsets, sizeof(int) * vertices);
+    for (int i = 0; i < num_edges; i++) {
+        int src = edges[i][0], dest = edges[i][1];
+        unsorted[fill[src]++] = dest;
+        unsorted[fill[dest]++] = src;
+    }
+
+    memcpy(fill, graph->offsets, sizeof(int) * vertices);
+    for (int v = 0; v < vertices; v++) {
+        for (int k = graph->offsets[v]; k < graph->offsets[v + 1]; k++) {
+            int u = unsorted[k];
+            graph->neighbors[fill[u]++] = v;
         }
     }
-    return total;
+
+    free(unsorted);
+    free(fill);
+    return graph;
+}
+
+void free_csr(CSRGraph* graph) {
+    if (!graph) return;
+    free(graph->offsets);
+    free(graph->neighbors);
+    free(graph);
+}
+
+// 이웃 순회: 정점의 이웃 배열 시작 주소와 차수를 돌려준다
+const int* csr_neighbors(CSRGraph* graph, int vertex, int* out_degree) {
+    if (vertex < 0 || vertex >= graph->num_vertices) {
+        *out_degree = 0;
+        return NULL;
+    }
+    *out_degree = graph->offsets[vertex + 1] - graph->offsets[vertex];
+    return graph->neighbors + graph->offsets[vertex];
+}
+
+// 정렬된 이웃 구간에서 이진 탐색: O(log degree)
+int csr_is_connected(CSRGraph* graph, int src, int dest, int* out_comparison) {
+    int comparison_count = 1;
+    int is_connected = 0;
+    if (src >= 0 && src < graph->num_vertices && dest >= 0 && dest < graph->num_vertices) {
+        int low = graph->offsets[src];
+        int high = graph->offsets[src + 1] - 1;
+        while (low <= high) {
+            int mid = low + (high - low) / 2;
+            comparison_count++;
+            if (graph->neighbors[mid] == dest) {
+                is_connected = 1;
+                break;
+            }
+            if (graph->neighbors[mid] < dest)
+                low = mid + 1;
+            else
+                high = mid - 1;
+        }
+    }
+    *out_comparison = comparison_count;
+    return is_connected;
+}
+
+void csr_print_neighbors(CSRGraph* graph, int vertex, int* out_comparison) {
+    int comparison_count = 1;
+    int degree = 0;
+    csr_neighbors(graph, vertex, &degree);
+    comparison_count += degree;
+    *out_comparison = comparison_count;
+}
+
+size_t csr_memory_usage(CSRGraph* graph) {
+    return sizeof(CSRGraph)
+        + ((size_t)graph->num_vertices + 1) * sizeof(int)
+        + 2 * (size_t)graph->num_edges * sizeof(int);
 }
 
 // ==================== 랜덤 그래프 간선 생성 ====================
-void generate_random_edges(int vertices, int num_edges, int edges[][2]) {
+
+// xoshiro256** 난수 생성기 (splitmix64로 시드)
+typedef struct {
+    uint64_t s[4];
+} Rng;
+
+static uint64_t rotl64(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+void rng_seed(Rng* rng, uint64_t seed) {
+    for (int i = 0; i < 4; i++) {
+        uint64_t z = (seed += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        rng->s[i] = z ^ (z >> 31);
+    }
+}
+
+uint64_t rng_next(Rng* rng) {
+    uint64_t* s = rng->s;
+    uint64_t result = rotl64(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl64(s[3], 45);
+    return result;
+}
+
+// [0, bound) 균등 분포, 나눗셈 없음
+uint32_t rng_below(Rng* rng, uint32_t bound) {
+    return (uint32_t)(((rng_next(rng) >> 32) * bound) >> 32);
+}
+
+// [0, 1) 균등 분포
+double rng_unit(Rng* rng) {
+    return (double)(rng_next(rng) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// 묶은 간선 키의 열린 주소 해시 집합 (선형 탐사, 용량은 2의 거듭제곱,
+// 부하율 1/2 이하)
+typedef struct {
+    uint64_t* slots;
+    size_t capacity;
+    size_t count;
+} EdgeSet;
+
+int edge_set_init(EdgeSet* set, size_t expected) {
+    size_t capacity = 16;
+    while (capacity < expected * 2) capacity <<= 1;
+    set->slots = (uint64_t*)malloc(sizeof(uint64_t) * capacity);
+    if (!set->slots) return 0;
+    memset(set->slots, 0xFF, sizeof(uint64_t) * capacity);
+    set->capacity = capacity;
+    set->count = 0;
+    return 1;
+}
+
+void edge_set_free(EdgeSet* set) {
+    free(set->slots);
+    set->slots = NULL;
+    set->capacity = set->count = 0;
+}
+
+static int edge_set_grow(EdgeSet* set) {
+    EdgeSet bigger;
+    if (!edge_set_init(&bigger, set->capacity)) return 0;
+    for (size_t i = 0; i < set->capacity; i++) {
+        uint64_t key = set->slots[i];
+        if (key == EDGE_EMPTY) continue;
+        size_t j = edge_hash(key, bigger.capacity);
+        while (bigger.slots[j] != EDGE_EMPTY) j = (j + 1) & (bigger.capacity - 1);
+        bigger.slots[j] = key;
+    }
+    bigger.count = set->count;
+    free(set->slots);
+    *set = bigger;
+    return 1;
+}
+
+// 1: 새로 넣음, 0: 이미 있음, -1: 메모리 부족
+int edge_set_insert(EdgeSet* set, uint64_t key) {
+    if ((set->count + 1) * 2 > set->capacity && !edge_set_grow(set)) return -1;
+    size_t i = edge_hash(key, set->capacity);
+    while (set->slots[i] != EDGE_EMPTY) {
+        if (set->slots[i] == key) return 0;
+        i = (i + 1) & (set->capacity - 1);
+    }
+    set->slots[i] = key;
+    set->count++;
+    return 1;
+}
+
+int edge_set_contains(const EdgeSet* set, uint64_t key) {
+    size_t i = edge_hash(key, set->capacity);
+    while (set->slots[i] != EDGE_EMPTY) {
+        if (set->slots[i] == key) return 1;
+        i = (i + 1) & (set->capacity - 1);
+    }
+    return 0;
+}
+
+typedef enum {
+    GRAPH_ER,         // Erdős–Rényi G(n, m): 모든 정점 쌍이 같은 확률
+    GRAPH_RMAT,       // R-MAT (a, b, c, d) = (0.57, 0.19, 0.19, 0.05)
+    GRAPH_POWER_LAW   // Chung-Lu: 정점 i의 가중치 (i+1)^(-1/(γ-1)), γ = 2.5
+} GraphModel;
+
+#define RMAT_A 0.57
+#define RMAT_B 0.19
+#define RMAT_C 0.19
+#define POWER_LAW_GAMMA 2.5
+// 포화된 모델에서 무한히 돌지 않도록 간선당 시도 횟수를 제한한다
+#define MAX_TRIES_PER_EDGE 64
+#define GEN_BATCH 64
+
+// 한 단계마다 16비트 난수로 사분면을 고른다 (난수 하나로 4단계)
+#define RMAT_SCALE_16(p) ((uint32_t)((p) * 65536.0))
+
+static void rmat_vertex_pair(Rng* rng, int scale, int* src, int* dest) {
+    const uint32_t a = RMAT_SCALE_16(RMAT_A);
+    const uint32_t ab = RMAT_SCALE_16(RMAT_A + RMAT_B);
+    const uint32_t abc = RMAT_SCALE_16(RMAT_A + RMAT_B + RMAT_C);
+    int u = 0, v = 0;
+    uint64_t bits = 0;
+    for (int level = 0; level < scale; level++) {
+        if ((level & 3) == 0) bits = rng_next(rng);
+        uint32_t r = (uint32_t)(bits & 0xFFFF);
+        bits >>= 16;
+        // 분기 없이: 아래 절반(c, d)이면 u 비트, b 또는 d이면 v 비트
+        u = (u << 1) | (r >= ab);
+        v = (v << 1) | ((r >= a) ^ (r >= ab) ^ (r >= abc));
+    }
+    *src = u;
+    *dest = v;
+}
+
+// Walker/Vose 별칭 표: 가중치에 비례해 정점을 O(1)에 뽑는다
+typedef struct {
+    double* prob;
+    int* alias;
+    int n;
+} AliasTable;
+
+int alias_init(AliasTable* table, const double* weights, int n) {
+    table->n = n;
+    table->prob = (double*)malloc(sizeof(double) * n);
+    table->alias = (int*)malloc(sizeof(int) * n);
+    int* small = (int*)malloc(sizeof(int) * n);
+    int* large = (int*)malloc(sizeof(int) * n);
+    if (!table->prob || !table->alias || !small || !large) {
+        free(table->prob);
+        free(table->alias);
+        free(small);
+        free(large);
+        return 0;
+    }
+
+    double total = 0.0;
+    for (int i = 0; i < n; i++) total += weights[i];
+    int num_small = 0, num_large = 0;
+    for (int i = 0; i < n; i++) {
+        table->prob[i] = weights[i] * n / total;
+        table->alias[i] = i;
+        if (table->prob[i] < 1.0) small[num_small++] = i;
+        else large[num_large++] = i;
+    }
+    while (num_small > 0 && num_large > 0) {
+        int s = small[--num_small];
+        int l = large[--num_large];
+        table->alias[s] = l;
+        table->prob[l] -= 1.0 - table->prob[s];
+        if (table->prob[l] < 1.0) small[num_small++] = l;
+        else large[num_large++] = l;
+    }
+    // 반올림 오차로 남은 칸은 확률 1
+    while (num_large > 0) table->prob[large[--num_large]] = 1.0;
+    while (num_small > 0) table->prob[small[--num_small]] = 1.0;
+
+    free(small);
+    free(large);
+    return 1;
+}
+
+int alias_sample(const AliasTable* table, Rng* rng) {
+    int i = (int)rng_below(rng, (uint32_t)table->n);
+    return rng_unit(rng) < table->prob[i] ? i : table->alias[i];
+}
+
+void alias_free(AliasTable* table) {
+    free(table->prob);
+    free(table->alias);
+}
+
+// 중복 없는 무방향 간선을 src < dest로 정규화해 edges에 쓴다. 중복은
+// 해시 집합으로 걸러 간선당 O(1)이며, 같은 seed는 같은 그래프를 만든다.
+// 만든 간선 수를 돌려준다 (정점 쌍이 모자라거나 모델이 포화되면 num_edges보다 적다).
+int generate_edges(GraphModel model, int vertices, int num_edges, int edges[][2], uint64_t seed) {
+    long long max_edges = (long long)vertices * (vertices - 1) / 2;
+    if (vertices < 2 || num_edges <= 0) return 0;
+    if (num_edges > max_edges) num_edges = (int)max_edges;
+
+    Rng rng;
+    rng_seed(&rng, seed);
+    EdgeSet seen;
+    if (!edge_set_init(&seen, (size_t)num_edges)) return 0;
+
+    int scale = 0;
+    while ((1 << scale) < vertices) scale++;
+
+    AliasTable weighted = { NULL, NULL, 0 };
+    if (model == GRAPH_POWER_LAW) {
+        double* weights = (double*)malloc(sizeof(double) * vertices);
+        int ok = weights != NULL;
+        if (ok) {
+            double exponent = -1.0 / (POWER_LAW_GAMMA - 1.0);
+            for (int i = 0; i < vertices; i++) weights[i] = pow(i + 1.0, exponent);
+            ok = alias_init(&weighted, weights, vertices);
+        }
+        free(weights);
+        if (!ok) {
+            edge_set_free(&seen);
+            return 0;
+        }
+    }
+
+    // 후보를 GEN_BATCH개씩 먼저 만들고 해시 칸을 프리페치한 뒤 넣으면
+    // 해시 집합의 캐시 미스가 서로 겹친다. 넣는 순서는 그대로라 결과는 같다.
+    uint64_t batch[GEN_BATCH];
     int count = 0;
-    while (count < num_edges) {
-        int src = rand() % vertices;
-        int dest = rand() % vertices;
+    long long tries_left = (long long)num_edges * MAX_TRIES_PER_EDGE;
+    while (count < num_edges && tries_left > 0) {
+        int batch_size = 0;
+        while (batch_size < GEN_BATCH && tries_left > 0) {
+            int src, dest;
+            tries_left--;
+            switch (model) {
+                case GRAPH_RMAT:
+                    rmat_vertex_pair(&rng, scale, &src, &dest);
+                    if (src >= vertices || dest >= vertices) continue;
+                    break;
+                case GRAPH_POWER_LAW:
+                    src = alias_sample(&weighted, &rng);
+                    dest = alias_sample(&weighted, &rng);
+                    break;
+                default:
+                    src = (int)rng_below(&rng, (uint32_t)vertices);
+                    dest = (int)rng_below(&rng, (uint32_t)vertices);
+                    break;
+            }
 
-        if (src == dest) continue; 
+            if (src == dest) continue; 
 
-        if (src > dest) {
-            int temp = src;
-            src = dest;
-            dest = temp;
+            if (src > dest) {
+                int temp = src;
+                src = dest;
+                dest = temp;
+            }
+            batch[batch_size] = pack_edge(src, dest);
+            __builtin_prefetch(&seen.slots[edge_hash(batch[batch_size], seen.capacity)]);
+            batch_size++;
         }
-        
-        int duplicate = 0;
-        for (int i = 0; i < count; i++) {
-            if (edges[i][0] == src && edges[i][1] == dest) {
-                duplicate = 1;
+
+        for (int i = 0; i < batch_size && count < num_edges; i++) {
+            int inserted = edge_set_insert(&seen, batch[i]);
+            if (inserted < 0) {
+                tries_left = 0;
                 break;
             }
+            if (inserted) {
+                edges[count][0] = (int)(batch[i] >> 32);
+                edges[count][1] = (int)(uint32_t)batch[i];
+                count++;
+            }
         }
+    }
 
-        if (!duplicate) {
-            edges[count][0] = src;
-            edges[count][1] = dest;
-            count++;
+    if (model == GRAPH_POWER_LAW) alias_free(&weighted);
+    edge_set_free(&seen);
+    return count;
+}
+
+void generate_random_edges(int vertices, int num_edges, int edges[][2]) {
+    uint64_t seed = ((uint64_t)rand() << 32) ^ (uint64_t)rand();
+    generate_edges(GRAPH_ER, vertices, num_edges, edges, seed);
+}
+
+// ==================== 실제 시간 측정 (ns) ====================
+
+#ifdef _WIN32
+long long get_time_ns() {
+    LARGE_INTEGER freq, counter;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (long long)((double)counter.QuadPart * 1e9 / freq.QuadPart);
+}
+#else
+long long get_time_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+#endif
+
+static volatile long long bench_sink;
+
+void print_bench_row(const char* name, double build_us, double connect_ns, double neighbor_ns, size_t memory) {
+    printf("%s: 생성 %.1f us | 연결 확인 %.1f ns | 이웃 순회 %.2f ns/간선 | 메모리 %zu Bytes\n",
+           name, build_us, connect_ns, neighbor_ns, memory);
+}
+
+// 같은 간선으로 각 표현을 만들고 생성 시간, 임의 정점 쌍의 연결 확인
+// 시간, 전체 이웃 순회의 간선당 시간을 잰다
+void benchmark_representations(const char* case_name, int vertices, int num_edges, int edges[][2]) {
+    static int queries[BENCH_QUERIES][2];
+    for (int i = 0; i < BENCH_QUERIES; i++) {
+        queries[i][0] = rand() % vertices;
+        queries[i][1] = rand() % vertices;
+    }
+    double total_visits = 2.0 * num_edges * BENCH_ROUNDS;
+    long long sum = 0;
+    long long t0;
+    double build_us, connect_ns, neighbor_ns;
+
+    printf("--------------------------------------------------\n");
+    printf("%s 실제 시간\n", case_name);
+
+    // 인접 행렬
+    t0 = get_time_ns();
+    AdjMatrix* matrix = create_adj_matrix(vertices);
+    if (!matrix) return;
+    for (int i = 0; i < num_edges; i++)
+        matrix_add_edge(matrix, edges[i][0], edges[i][1]);
+    build_us = (get_time_ns() - t0) / 1e3;
+
+    t0 = get_time_ns();
+    for (int i = 0; i < BENCH_QUERIES; i++)
+        sum += matrix_has_edge(matrix, queries[i][0], queries[i][1]);
+    connect_ns = (double)(get_time_ns() - t0) / BENCH_QUERIES;
+
+    t0 = get_time_ns();
+    for (int r = 0; r < BENCH_ROUNDS; r++)
+        for (int v = 0; v < vertices; v++) {
+            const uint64_t* row = matrix_row(matrix, v);
+            for (int w = 0; w < matrix->words_per_row; w++)
+                for (uint64_t bits = row[w]; bits; bits &= bits - 1)
+                    sum += w * 64 + __builtin_ctzll(bits);
+        }
+    neighbor_ns = (get_time_ns() - t0) / total_visits;
+    print_bench_row("인접 행렬", build_us, connect_ns, neighbor_ns, matrix_memory_usage(matrix));
+
+    t0 = get_time_ns();
+    for (int i = 0; i < BENCH_QUERIES; i++)
+        sum += matrix_common_neighbors(matrix, queries[i][0], queries[i][1]);
+    printf("인접 행렬 공통 이웃 수 (AND+popcount): %.1f ns\n",
+           (double)(get_time_ns() - t0) / BENCH_QUERIES);
+    free_adj_matrix(matrix);
+
+    // 인접 리스트
+    t0 = get_time_ns();
+    AdjList* list = create_adj_list(vertices);
+    if (!list) return;
+    for (int i = 0; i < num_edges; i++)
+        list_add_edge(list, edges[i][0], edges[i][1]);
+    build_us = (get_time_ns() - t0) / 1e3;
+
+    t0 = get_time_ns();
+    for (int i = 0; i < BENCH_QUERIES; i++) {
+        int comparison = 0;
+        sum += list_is_connected(list, queries[i][0], queries[i][1], &comparison);
+    }
+    connect_ns = (double)(get_time_ns() - t0) / BENCH_QUERIES;
+
+    t0 = get_time_ns();
+    for (int r = 0; r < BENCH_ROUNDS; r++)
+        for (int v = 0; v < vertices; v++)
+            for (int k = 0; k < list->array[v].count; k++)
+                sum += list->array[v].items[k];
+    neighbor_ns = (get_time_ns() - t0) / total_visits;
+    print_bench_row("인접 리스트", build_us, connect_ns, neighbor_ns, list_memory_usage(list));
+
+    // 인접 리스트 + 간선 색인 (이웃 순회는 같은 배열이라 위와 같다)
+    t0 = get_time_ns();
+    if (!list_enable_edge_index(list)) {
+        free_adj_list(list);
+        return;
+    }
+    build_us += (get_time_ns() - t0) / 1e3;
+
+    t0 = get_time_ns();
+    for (int i = 0; i < BENCH_QUERIES; i++) {
+        int comparison = 0;
+        sum += list_is_connected(list, queries[i][0], queries[i][1], &comparison);
+    }
+    connect_ns = (double)(get_time_ns() - t0) / BENCH_QUERIES;
+    print_bench_row("인접 리스트 + 간선 색인", build_us, connect_ns, neighbor_ns, list_memory_usage(list));
+    free_adj_list(list);
+
+    // CSR
+    t0 = get_time_ns();
+    CSRGraph* csr = create_csr(vertices, num_edges, edges);
+    if (!csr) return;
+    build_us = (get_time_ns() - t0) / 1e3;
+
+    t0 = get_time_ns();
+    for (int i = 0; i < BENCH_QUERIES; i++) {
+        int comparison = 0;
+        sum += csr_is_connected(csr, queries[i][0], queries[i][1], &comparison);
+    }
+    connect_ns = (double)(get_time_ns() - t0) / BENCH_QUERIES;
+
+    t0 = get_time_ns();
+    for (int r = 0; r < BENCH_ROUNDS; r++)
+        for (int v = 0; v < vertices; v++) {
+            int degree = 0;
+            const int* neighbors = csr_neighbors(csr, v, &degree);
+            for (int k = 0; k < degree; k++)
+                sum += neighbors[k];
         }
+    neighbor_ns = (get_time_ns() - t0) / total_visits;
+    print_bench_row("CSR", build_us, connect_ns, neighbor_ns, csr_memory_usage(csr));
+    free_csr(csr);
+
+    bench_sink = sum;
+    printf("\n");
+}
+
+// 부하 테스트용 대형 그래프: 모델별 생성 속도와 차수 분포의 치우침
+void benchmark_generators(uint64_t seed) {
+    static const char* names[] = { "Erdős–Rényi", "R-MAT", "Power-law" };
+    int (*edges)[2] = malloc(sizeof(int[2]) * LARGE_EDGES);
+    if (!edges) return;
+
+    printf("--------------------------------------------------\n");
+    printf("대형 그래프 생성 (V=%d, E=%d, seed=%llu)\n", LARGE_VERTICES, LARGE_EDGES, (unsigned long long)seed);
+    for (int model = GRAPH_ER; model <= GRAPH_POWER_LAW; model++) {
+        long long t0 = get_time_ns();
+        int count = generate_edges((GraphModel)model, LARGE_VERTICES, LARGE_EDGES, edges, seed);
+        double seconds = (get_time_ns() - t0) / 1e9;
+
+        CSRGraph* csr = create_csr(LARGE_VERTICES, count, edges);
+        int max_degree = 0;
+        if (csr) {
+            for (int v = 0; v < LARGE_VERTICES; v++) {
+                int degree = csr->offsets[v + 1] - csr->offsets[v];
+                if (degree > max_degree) max_degree = degree;
+            }
+            free_csr(csr);
+        }
+        printf("%s: 간선 %d개, %.1f ms (%.1f M간선/s), 최대 차수 %d\n",
+               names[model], count, seconds * 1e3, count / seconds / 1e6, max_degree);
     }
+    printf("\n");
+    free(edges);
 }
 
 // ==================== 결과 출력 함수 ====================
@@ -258,6 +1097,23 @@ void print_result_korean(const char* case_name, size_t memory,
     printf("4. 특정 노드의 인접 노드 출력 비교 횟수: %d 번\n\n", neighbor_comp);
 }
 
+// 비트 행렬만의 워드 병렬 연산 결과
+void print_matrix_extras(AdjMatrix* graph) {
+    printf("5. 정점 0의 차수 (popcount): %d\n", matrix_degree(graph, 0));
+    printf("6. 정점 0, 1의 공통 이웃 수 (AND+popcount): %d\n\n", matrix_common_neighbors(graph, 0, 1));
+}
+
+// CSR은 불변이라 삽입/삭제 대신 전체 재생성으로 간선을 바꾼다
+void print_csr_result_korean(const char* case_name, size_t memory,
+                  int connect_comp, int neighbor_comp) {
+    printf("--------------------------------------------------\n");
+    printf("%s\n", case_name);
+    printf("1. 그래프 사용 메모리 용량: %zu Bytes\n", memory);
+    printf("2. 간선 삽입/삭제: 불변 구조 (간선 목록에서 O(V+E) 재생성)\n");
+    printf("3. 두 정점의 연결 여부 확인 비교 횟수: %d 번\n", connect_comp);
+    printf("4. 특정 노드의 인접 노드 출력 비교 횟수: %d 번\n\n", neighbor_comp);
+}
+
 // ==================== 메인 함수 ====================
 int main() {
     srand(time(NULL)); 
@@ -286,7 +1142,8 @@ int main() {
     size_t memory_1 = matrix_memory_usage(sparse_matrix);
     
     print_result_korean("케이스 1: 희소 그래프 - 인접 행렬", memory_1, insert_comp_1, delete_comp_1, connect_comp_1, neighbor_comp_1);
-    free(sparse_matrix);
+    print_matrix_extras(sparse_matrix);
+    free_adj_matrix(sparse_matrix);
 
     // --------------------------------------------------
     // --- 2. 희소 그래프 - 인접 리스트 (V=100, E=100) ---
@@ -324,7 +1181,8 @@ int main() {
     size_t memory_3 = matrix_memory_usage(dense_matrix);
     
     print_result_korean("케이스 3: 밀집 그래프 - 인접 행렬", memory_3, insert_comp_3, delete_comp_3, connect_comp_3, neighbor_comp_3);
-    free(dense_matrix);
+    print_matrix_extras(dense_matrix);
+    free_adj_matrix(dense_matrix);
 
     // --------------------------------------------------
     // --- 4. 밀집 그래프 - 인접 리스트 (V=100, E=4000) ---
@@ -346,5 +1204,65 @@ int main() {
     print_result_korean("케이스 4: 밀집 그래프 - 인접 리스트", memory_4, insert_comp_4, delete_comp_4, connect_comp_4, neighbor_comp_4);
     free_adj_list(dense_list);
 
+    // --------------------------------------------------
+    // --- 5. 희소 그래프 - CSR (V=100, E=100) ---
+    // --------------------------------------------------
+    CSRGraph* sparse_csr = create_csr(MAX_VERTICES, SPARSE_EDGES, sparse_edges);
+    if (!sparse_csr) return 1;
+
+    int connect_comp_5 = 0;
+    csr_is_connected(sparse_csr, 0, 1, &connect_comp_5);
+    int neighbor_comp_5 = 0;
+    csr_print_neighbors(sparse_csr, 0, &neighbor_comp_5);
+    print_csr_result_korean("케이스 5: 희소 그래프 - CSR", csr_memory_usage(sparse_csr), connect_comp_5, neighbor_comp_5);
+    free_csr(sparse_csr);
+
+    // --------------------------------------------------
+    // --- 6. 밀집 그래프 - CSR (V=100, E=4000) ---
+    // --------------------------------------------------
+    CSRGraph* dense_csr = create_csr(MAX_VERTICES, DENSE_EDGES, dense_edges);
+    if (!dense_csr) return 1;
+
+    int connect_comp_6 = 0;
+    csr_is_connected(dense_csr, 0, 1, &connect_comp_6);
+    int neighbor_comp_6 = 0;
+    csr_print_neighbors(dense_csr, 0, &neighbor_comp_6);
+    print_csr_result_korean("케이스 6: 밀집 그래프 - CSR", csr_memory_usage(dense_csr), connect_comp_6, neighbor_comp_6);
+    free_csr(dense_csr);
+
+    // --------------------------------------------------
+    // --- 7, 8. 인접 리스트 + 간선 색인 (V=100) ---
+    // --------------------------------------------------
+    for (int dense = 0; dense <= 1; dense++) {
+        int num_edges = dense ? DENSE_EDGES : SPARSE_EDGES;
+        int (*edges)[2] = dense ? dense_edges : sparse_edges;
+        AdjList* indexed_list = create_adj_list(MAX_VERTICES);
+        if (!indexed_list || !list_enable_edge_index(indexed_list)) {
+            free_adj_list(indexed_list);
+            return 1;
+        }
+
+        int insert_comp = 0;
+        for (int i = 0; i < num_edges; i++)
+            insert_comp += list_add_edge(indexed_list, edges[i][0], edges[i][1]);
+
+        int connect_comp = 0;
+        list_is_connected(indexed_list, 0, 1, &connect_comp);
+        int neighbor_comp = 0;
+        list_print_neighbors(indexed_list, 0, &neighbor_comp);
+        int delete_comp = list_remove_edge(indexed_list, edges[0][0], edges[0][1]);
+        print_result_korean(dense ? "케이스 8: 밀집 그래프 - 인접 리스트 + 간선 색인"
+                                  : "케이스 7: 희소 그래프 - 인접 리스트 + 간선 색인",
+                            list_memory_usage(indexed_list), insert_comp, delete_comp, connect_comp, neighbor_comp);
+        free_adj_list(indexed_list);
+    }
+
+    // --------------------------------------------------
+    // --- 실제 시간 비교 ---
+    // --------------------------------------------------
+    benchmark_representations("희소 그래프 (V=100, E=100)", MAX_VERTICES, SPARSE_EDGES, sparse_edges);
+    benchmark_representations("밀집 그래프 (V=100, E=4000)", MAX_VERTICES, DENSE_EDGES, dense_edges);
+    benchmark_generators((uint64_t)time(NULL));
+
     return 0;
 }
\ No newline at end of file
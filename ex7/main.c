@@ -1,46 +1,168 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <stdbool.h>
+#include <stdatomic.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
 
 #define V 10  // 정점의 개수
 #define E 20  // 간선의 개수
 #define INF -1  // 경로가 없음을 나타냄
 
-// BFS를 위한 큐 구조체
+#define LARGE_V (1 << 20)       // 대형 그래프 정점 수
+#define LARGE_E (8LL << 20)     // 대형 그래프 무방향 간선 수
+#define APSP_V 4096             // 전체 쌍 벤치마크 정점 수
+#define APSP_E 16384            // 전체 쌍 벤치마크 무방향 간선 수
+#define OUTPUT_BUFFER_SIZE (1 << 16)
+#define QUEUE_BENCH_OPS (1 << 26)       // 큐 벤치마크 원소 수
+#define QUEUE_BENCH_BATCH 4096          // 한 번에 넣고 빼는 원소 수
+#define SPSC_CAPACITY 4096
+
+// BFS를 위한 큐: 용량이 2의 거듭제곱인 원형 버퍼. head와 tail은 계속
+// 증가만 하고 mask로 위치를 구하므로 tail - head가 곧 원소 수다. 가득 차면
+// 두 배로 늘리고, clearQueue로 비우면 버퍼를 다음 BFS에 그대로 다시 쓴다.
+#define QUEUE_MIN_CAPACITY 16
+
 typedef struct {
-    int items[V];
-    int front;
-    int rear;
+    int* items;
+    unsigned int mask;      // 용량 - 1
+    unsigned int head;      // 다음에 꺼낼 위치
+    unsigned int tail;      // 다음에 넣을 위치
 } Queue;
 
-// 큐 초기화
-void initQueue(Queue* q) {
-    q->front = -1;
-    q->rear = -1;
+// 큐 초기화 (capacity는 처음 용량의 힌트)
+bool initQueue(Queue* q, int capacity) {
+    unsigned int cap = QUEUE_MIN_CAPACITY;
+    while (cap < (unsigned int)capacity && cap < (1u << 30)) cap <<= 1;
+    q->items = (int*)malloc(sizeof(int) * cap);
+    q->mask = q->items != NULL ? cap - 1 : 0;
+    q->head = q->tail = 0;
+    return q->items != NULL;
+}
+
+void freeQueue(Queue* q) {
+    free(q->items);
+    q->items = NULL;
+    q->mask = 0;
+    q->head = q->tail = 0;
+}
+
+// 버퍼는 남겨 두고 비운다
+void clearQueue(Queue* q) {
+    q->head = q->tail = 0;
 }
 
 // 큐가 비어있는지 확인
 bool isEmpty(Queue* q) {
-    return q->front == -1;
+    return q->head == q->tail;
 }
 
-// 큐에 원소 추가
-void enqueue(Queue* q, int value) {
-    if (q->front == -1)
-        q->front = 0;
-    q->rear++;
-    q->items[q->rear] = value;
+int queueSize(Queue* q) {
+    return (int)(q->tail - q->head);
 }
 
-// 큐에서 원소 제거
+// 용량을 두 배로 늘리고 원소를 0번부터 순서대로 옮긴다
+static bool growQueue(Queue* q) {
+    unsigned int cap = q->mask + 1;
+    if (cap >= (1u << 30)) return false;
+    int* items = (int*)malloc(sizeof(int) * cap * 2);
+    if (items == NULL) return false;
+
+    unsigned int count = q->tail - q->head;
+    unsigned int start = q->head & q->mask;
+    unsigned int first = cap - start < count ? cap - start : count;
+    memcpy(items, q->items + start, sizeof(int) * first);
+    memcpy(items + first, q->items, sizeof(int) * (count - first));
+
+    free(q->items);
+    q->items = items;
+    q->mask = cap * 2 - 1;
+    q->head = 0;
+    q->tail = count;
+    return true;
+}
+
+// 큐에 원소 추가 (메모리가 모자라면 false)
+bool enqueue(Queue* q, int value) {
+    if (q->tail - q->head > q->mask && !growQueue(q)) return false;
+    q->items[q->tail++ & q->mask] = value;
+    return true;
+}
+
+// 큐에서 원소 제거 (비어 있지 않아야 한다)
 int dequeue(Queue* q) {
-    int item = q->items[q->front];
-    q->front++;
-    if (q->front > q->rear) {
-        q->front = q->rear = -1;
+    return q->items[q->head++ & q->mask];
+}
+
+// ==================== SPSC 큐 ====================
+//
+// 파이프라인 단계 사이에 정점을 넘기는 단일 생산자/단일 소비자 큐. 락 없이
+// tail은 생산자만, head는 소비자만 쓰고, 상대 쪽 값은 acquire로 읽는다.
+// 상대 값을 캐시해 두었다가 그것으로 모자랄 때만 다시 읽어서 캐시 라인이
+// 오가는 횟수를 줄인다. 용량은 고정이다.
+
+#define CACHE_LINE 64
+#define SPSC_SPINS 256          // 이만큼 헛돌면 상대 스레드에게 CPU를 양보한다
+
+typedef struct {
+    int* items;
+    unsigned int mask;
+    char pad0[CACHE_LINE];
+    atomic_uint tail;           // 생산자가 쓴다
+    unsigned int cachedHead;    // 생산자가 마지막으로 본 head
+    char pad1[CACHE_LINE];
+    atomic_uint head;           // 소비자가 쓴다
+    unsigned int cachedTail;    // 소비자가 마지막으로 본 tail
+    char pad2[CACHE_LINE];
+} SPSCQueue;
+
+// capacity는 2의 거듭제곱으로 올림한다
+bool initSPSCQueue(SPSCQueue* q, int capacity) {
+    unsigned int cap = QUEUE_MIN_CAPACITY;
+    while (cap < (unsigned int)capacity && cap < (1u << 30)) cap <<= 1;
+    q->items = (int*)malloc(sizeof(int) * cap);
+    q->mask = cap - 1;
+    atomic_init(&q->tail, 0);
+    atomic_init(&q->head, 0);
+    q->cachedHead = q->cachedTail = 0;
+    return q->items != NULL;
+}
+
+void freeSPSCQueue(SPSCQueue* q) {
+    free(q->items);
+    q->items = NULL;
+}
+
+// 생산자 쪽. 가득 차 있으면 false
+bool spscPush(SPSCQueue* q, int value) {
+    unsigned int tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    if (tail - q->cachedHead > q->mask) {
+        q->cachedHead = atomic_load_explicit(&q->head, memory_order_acquire);
+        if (tail - q->cachedHead > q->mask) return false;
     }
-    return item;
+    q->items[tail & q->mask] = value;
+    atomic_store_explicit(&q->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+// 소비자 쪽. 비어 있으면 false
+bool spscPop(SPSCQueue* q, int* value) {
+    unsigned int head = atomic_load_explicit(&q->head, memory_order_relaxed);
+    if (head == q->cachedTail) {
+        q->cachedTail = atomic_load_explicit(&q->tail, memory_order_acquire);
+        if (head == q->cachedTail) return false;
+    }
+    *value = q->items[head & q->mask];
+    atomic_store_explicit(&q->head, head + 1, memory_order_release);
+    return true;
 }
 
 // 무작위 그래프 생성
@@ -77,7 +199,7 @@ void BFS(int graph[V][V], int src, int dist[], int parent[]) {
         parent[i] = -1;  
     }
     
-    initQueue(&q);
+    if (!initQueue(&q, V)) return;
     visited[src] = true;
     dist[src] = 0;
     enqueue(&q, src);
@@ -95,21 +217,385 @@ void BFS(int graph[V][V], int src, int dist[], int parent[]) {
             }
         }
     }
+    freeQueue(&q);
 }
 
-void printPath(int parent[], int src, int dest) {
-    if (dest == src) {
-        printf("%d", src);
-        return;
+// ==================== 희소 그래프 (CSR) ====================
+
+// 정점 u의 이웃은 neighbors[offsets[u] .. offsets[u+1])
+typedef struct {
+    int numVertices;
+    long long numEdges;     // 방향 간선 수 (무방향 간선 하나당 2)
+    long long* offsets;
+    int* neighbors;
+} Graph;
+
+void freeGraph(Graph* g) {
+    if (g == NULL) return;
+    free(g->offsets);
+    free(g->neighbors);
+    free(g);
+}
+
+// 무방향 간선 목록에서 O(V+E)로 만든다 (중복 간선은 그대로 둔다)
+Graph* buildGraph(int n, int (*edges)[2], long long m) {
+    Graph* g = (Graph*)malloc(sizeof(Graph));
+    if (g == NULL) return NULL;
+    g->numVertices = n;
+    g->numEdges = 2 * m;
+    g->offsets = (long long*)calloc((size_t)n + 1, sizeof(long long));
+    g->neighbors = (int*)malloc(sizeof(int) * (size_t)(2 * m + 1));
+    long long* fill = (long long*)malloc(sizeof(long long) * (size_t)n);
+    if (g->offsets == NULL || g->neighbors == NULL || fill == NULL) {
+        free(fill);
+        freeGraph(g);
+        return NULL;
     }
-    
-    if (parent[dest] == -1) {
-        printf("경로 없음");
-        return;
+
+    for (long long i = 0; i < m; i++) {
+        g->offsets[edges[i][0] + 1]++;
+        g->offsets[edges[i][1] + 1]++;
     }
-    
-    printPath(parent, src, parent[dest]);
-    printf(" -> %d", dest);
+    for (int u = 0; u < n; u++) {
+        g->offsets[u + 1] += g->offsets[u];
+    }
+    memcpy(fill, g->offsets, sizeof(long long) * n);
+    for (long long i = 0; i < m; i++) {
+        int u = edges[i][0], v = edges[i][1];
+        g->neighbors[fill[u]++] = v;
+        g->neighbors[fill[v]++] = u;
+    }
+    free(fill);
+    return g;
+}
+
+Graph* graphFromMatrix(int graph[V][V]) {
+    int edges[V * V][2];
+    long long m = 0;
+    for (int i = 0; i < V; i++) {
+        for (int j = i + 1; j < V; j++) {
+            if (graph[i][j] == 1) {
+                edges[m][0] = i;
+                edges[m][1] = j;
+                m++;
+            }
+        }
+    }
+    return buildGraph(V, edges, m);
+}
+
+// splitmix64: 시드만 있으면 같은 그래프를 다시 만든다
+unsigned long long nextRandom(unsigned long long* state) {
+    unsigned long long z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// 정점 n개, 무작위 무방향 간선 m개 (자기 루프 제외, 중복 허용)
+Graph* createRandomSparseGraph(int n, long long m, unsigned long long seed) {
+    int (*edges)[2] = malloc(sizeof(int[2]) * (size_t)m);
+    if (edges == NULL) return NULL;
+    long long count = 0;
+    while (count < m) {
+        unsigned long long r = nextRandom(&seed);
+        int u = (int)((r & 0xFFFFFFFFULL) * (unsigned long long)n >> 32);
+        int v = (int)((r >> 32) * (unsigned long long)n >> 32);
+        if (u == v) continue;
+        edges[count][0] = u;
+        edges[count][1] = v;
+        count++;
+    }
+    Graph* g = buildGraph(n, edges, m);
+    free(edges);
+    return g;
+}
+
+// 단일 스레드 BFS (비교 기준). 큐는 동시에 들어 있는 정점 수만큼만 자라고, 작업
+// 공간으로만 쓰므로 여러 번 호출할 때 같은 큐를 넘기면 다시 할당하지 않는다.
+// 닿은 정점 수를 돌려준다 (메모리가 모자라면 0).
+int sparseBFSWithQueue(const Graph* g, int src, int dist[], int parent[], Queue* q) {
+    int n = g->numVertices;
+    for (int i = 0; i < n; i++) {
+        dist[i] = INF;
+        parent[i] = -1;
+    }
+
+    int reached = 1;
+    clearQueue(q);
+    dist[src] = 0;
+    if (!enqueue(q, src)) return 0;
+    while (!isEmpty(q)) {
+        int u = dequeue(q);
+        for (long long k = g->offsets[u]; k < g->offsets[u + 1]; k++) {
+            int v = g->neighbors[k];
+            if (dist[v] == INF) {
+                dist[v] = dist[u] + 1;
+                parent[v] = u;
+                if (!enqueue(q, v)) return 0;
+                reached++;
+            }
+        }
+    }
+    return reached;
+}
+
+int sparseBFS(const Graph* g, int src, int dist[], int parent[]) {
+    Queue q;
+    if (!initQueue(&q, 0)) return 0;
+    int reached = sparseBFSWithQueue(g, src, dist, parent, &q);
+    freeQueue(&q);
+    return reached;
+}
+
+// ==================== 병렬 방향 최적화 BFS ====================
+//
+// 프런티어, 다음 프런티어, 방문 여부는 정점당 1비트인 비트맵이다. 단계마다
+// 두 방향 중 하나로 확장한다 (Beamer의 direction-optimizing BFS):
+//  - 하향식: 프런티어 정점의 이웃을 본다. 여러 스레드가 같은 정점을 찾을 수
+//    있으므로 방문 비트를 atomic fetch_or로 차지한 스레드만 기록한다.
+//  - 상향식: 아직 방문하지 않은 정점마다 이웃 중 프런티어에 있는 것을 찾고,
+//    찾으면 바로 멈춘다. 비트맵 워드를 스레드가 나눠 가지므로 원자 연산이
+//    필요 없다. 프런티어가 커서 대부분의 간선이 헛수고가 될 때 유리하다.
+// 스레드는 BFS_CHUNK_WORDS 워드씩 공유 커서에서 일을 가져가 부하를 맞춘다.
+
+#define BFS_ALPHA 14            // 프런티어 간선 > 남은 간선 / ALPHA 이면 상향식
+#define BFS_BETA 24             // 프런티어 정점 < n / BETA 이면 다시 하향식
+#define BFS_CHUNK_WORDS 64
+#define BFS_PARALLEL_MIN 4096   // 프런티어 간선이 이보다 적으면 스레드 없이
+
+typedef struct {
+    int topDownSteps;
+    int bottomUpSteps;
+} BFSStats;
+
+typedef struct {
+    const Graph* g;
+    atomic_ullong* visited;
+    atomic_ullong* frontier;
+    atomic_ullong* next;
+    int* dist;
+    int* parent;
+    int level;
+    int numWords;
+    bool bottomUp;
+    atomic_int cursor;
+} BFSLevel;
+
+typedef struct {
+    BFSLevel* shared;
+    long long nextCount;   // 이번 단계에 찾은 정점 수
+    long long nextEdges;   // 그 정점들의 차수 합
+} BFSJob;
+
+static void topDownChunk(BFSJob* job, int wordStart, int wordEnd) {
+    BFSLevel* L = job->shared;
+    const Graph* g = L->g;
+    for (int w = wordStart; w < wordEnd; w++) {
+        unsigned long long bits = atomic_load_explicit(&L->frontier[w], memory_order_relaxed);
+        while (bits) {
+            int u = w * 64 + __builtin_ctzll(bits);
+            bits &= bits - 1;
+            for (long long k = g->offsets[u]; k < g->offsets[u + 1]; k++) {
+                int v = g->neighbors[k];
+                unsigned long long bit = 1ULL << (v & 63);
+                if (atomic_load_explicit(&L->visited[v >> 6], memory_order_relaxed) & bit) continue;
+                if (atomic_fetch_or_explicit(&L->visited[v >> 6], bit, memory_order_relaxed) & bit) continue;
+                L->dist[v] = L->level + 1;
+                L->parent[v] = u;
+                atomic_fetch_or_explicit(&L->next[v >> 6], bit, memory_order_relaxed);
+                job->nextCount++;
+                job->nextEdges += g->offsets[v + 1] - g->offsets[v];
+            }
+        }
+    }
+}
+
+static void bottomUpChunk(BFSJob* job, int wordStart, int wordEnd) {
+    BFSLevel* L = job->shared;
+    const Graph* g = L->g;
+    int n = g->numVertices;
+    for (int w = wordStart; w < wordEnd; w++) {
+        unsigned long long seen = atomic_load_explicit(&L->visited[w], memory_order_relaxed);
+        unsigned long long todo = ~seen;
+        if (w == L->numWords - 1 && (n & 63)) todo &= (1ULL << (n & 63)) - 1;
+        unsigned long long found = 0;
+        while (todo) {
+            int v = w * 64 + __builtin_ctzll(todo);
+            todo &= todo - 1;
+            for (long long k = g->offsets[v]; k < g->offsets[v + 1]; k++) {
+                int u = g->neighbors[k];
+                if (atomic_load_explicit(&L->frontier[u >> 6], memory_order_relaxed) & (1ULL << (u & 63))) {
+                    L->dist[v] = L->level + 1;
+                    L->parent[v] = u;
+                    found |= 1ULL << (v & 63);
+                    job->nextCount++;
+                    job->nextEdges += g->offsets[v + 1] - g->offsets[v];
+                    break;
+                }
+            }
+        }
+        // 이 워드는 이 스레드만 쓴다
+        if (found) {
+            atomic_store_explicit(&L->visited[w], seen | found, memory_order_relaxed);
+            atomic_store_explicit(&L->next[w], found, memory_order_relaxed);
+        }
+    }
+}
+
+static void runBFSJob(BFSJob* job) {
+    BFSLevel* L = job->shared;
+    for (;;) {
+        int start = atomic_fetch_add(&L->cursor, BFS_CHUNK_WORDS);
+        if (start >= L->numWords) break;
+        int end = start + BFS_CHUNK_WORDS < L->numWords ? start + BFS_CHUNK_WORDS : L->numWords;
+        if (L->bottomUp) bottomUpChunk(job, start, end);
+        else topDownChunk(job, start, end);
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI bfsWorker(LPVOID arg) {
+    runBFSJob((BFSJob*)arg);
+    return 0;
+}
+
+int cpuCount(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+}
+#else
+static void* bfsWorker(void* arg) {
+    runBFSJob((BFSJob*)arg);
+    return NULL;
+}
+
+int cpuCount(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+}
+#endif
+
+// 한 단계를 numThreads개 스레드로 돌린다. 0번은 호출한 스레드에서 돌고,
+// 만들지 못한 스레드의 몫은 공유 커서를 통해 나머지가 가져간다.
+static void runBFSLevel(BFSJob jobs[], int numThreads) {
+#ifdef _WIN32
+    HANDLE handles[64];
+#else
+    pthread_t handles[64];
+#endif
+    bool started[64] = { false };
+    if (numThreads > 64) numThreads = 64;
+
+    for (int t = 1; t < numThreads; t++) {
+#ifdef _WIN32
+        handles[t] = CreateThread(NULL, 0, bfsWorker, &jobs[t], 0, NULL);
+        started[t] = handles[t] != NULL;
+#else
+        started[t] = pthread_create(&handles[t], NULL, bfsWorker, &jobs[t]) == 0;
+#endif
+    }
+    runBFSJob(&jobs[0]);
+    for (int t = 1; t < numThreads; t++) {
+        if (!started[t]) continue;
+#ifdef _WIN32
+        WaitForSingleObject(handles[t], INFINITE);
+        CloseHandle(handles[t]);
+#else
+        pthread_join(handles[t], NULL);
+#endif
+    }
+}
+
+// src에서 모든 정점까지의 홉 수(dist, 닿지 않으면 INF)와 BFS 트리(parent)를
+// 구한다. numThreads <= 0이면 코어 수만큼. 닿은 정점 수를 돌려준다.
+int parallelBFS(const Graph* g, int src, int dist[], int parent[], int numThreads, BFSStats* stats) {
+    int n = g->numVertices;
+    int numWords = (n + 63) / 64;
+    if (numThreads <= 0) numThreads = cpuCount();
+    if (numThreads > 64) numThreads = 64;
+
+    atomic_ullong* bitmaps = (atomic_ullong*)malloc(sizeof(atomic_ullong) * 3 * (size_t)numWords);
+    BFSJob* jobs = (BFSJob*)malloc(sizeof(BFSJob) * numThreads);
+    BFSLevel* L = (BFSLevel*)malloc(sizeof(BFSLevel));
+    if (bitmaps == NULL || jobs == NULL || L == NULL) {
+        free(bitmaps);
+        free(jobs);
+        free(L);
+        return sparseBFS(g, src, dist, parent);
+    }
+    for (int i = 0; i < 3 * numWords; i++) {
+        atomic_init(&bitmaps[i], 0);
+    }
+    for (int i = 0; i < n; i++) {
+        dist[i] = INF;
+        parent[i] = -1;
+    }
+
+    L->g = g;
+    L->visited = bitmaps;
+    L->frontier = bitmaps + numWords;
+    L->next = bitmaps + 2 * numWords;
+    L->dist = dist;
+    L->parent = parent;
+    L->numWords = numWords;
+    L->bottomUp = false;
+
+    dist[src] = 0;
+    atomic_store(&L->visited[src >> 6], 1ULL << (src & 63));
+    atomic_store(&L->frontier[src >> 6], 1ULL << (src & 63));
+
+    long long frontierCount = 1;
+    long long frontierEdges = g->offsets[src + 1] - g->offsets[src];
+    long long unexploredEdges = g->numEdges - frontierEdges;
+    long long reached = 1;
+    if (stats) stats->topDownSteps = stats->bottomUpSteps = 0;
+
+    for (int level = 0; frontierCount > 0; level++) {
+        if (!L->bottomUp && frontierEdges > unexploredEdges / BFS_ALPHA) {
+            L->bottomUp = true;
+        } else if (L->bottomUp && frontierCount < n / BFS_BETA) {
+            L->bottomUp = false;
+        }
+        if (stats) {
+            if (L->bottomUp) stats->bottomUpSteps++;
+            else stats->topDownSteps++;
+        }
+
+        for (int w = 0; w < numWords; w++) {
+            atomic_store_explicit(&L->next[w], 0, memory_order_relaxed);
+        }
+        L->level = level;
+        atomic_store(&L->cursor, 0);
+
+        // 작은 단계는 스레드를 만드는 비용이 더 크다
+        int threads = L->bottomUp || frontierEdges >= BFS_PARALLEL_MIN ? numThreads : 1;
+        for (int t = 0; t < threads; t++) {
+            jobs[t].shared = L;
+            jobs[t].nextCount = 0;
+            jobs[t].nextEdges = 0;
+        }
+        runBFSLevel(jobs, threads);
+
+        frontierCount = 0;
+        frontierEdges = 0;
+        for (int t = 0; t < threads; t++) {
+            frontierCount += jobs[t].nextCount;
+            frontierEdges += jobs[t].nextEdges;
+        }
+        unexploredEdges -= frontierEdges;
+        reached += frontierCount;
+
+        atomic_ullong* temp = L->frontier;
+        L->frontier = L->next;
+        L->next = temp;
+    }
+
+    free(bitmaps);
+    free(jobs);
+    free(L);
+    return (int)reached;
 }
 
 // 그래프 출력
@@ -144,43 +630,437 @@ void printGraph(int graph[V][V]) {
     printf("총 간선 개수: %d\n\n", edgeCount);
 }
 
-int main() {
+// ==================== 전체 쌍 최단 홉 수 (MS-BFS) ====================
+//
+// 출발점 64개를 한 번에 돈다 (Then et al.의 multi-source BFS). 정점마다
+// 64비트 워드 하나가 "어느 출발점이 이 정점을 봤는가"를 나타내므로, 간선
+// 하나를 한 번 훑으면 64개 BFS가 함께 한 걸음씩 나아간다.
+//
+// 거리는 n x n 행렬에 1바이트씩 담고 (255 = 경로 없음), 254홉을 넘는
+// 거리가 나오면 그때 2바이트로 넓힌다. 부모는 저장하지 않는다: 경로가
+// 필요할 때 거리가 하나씩 줄어드는 이웃을 따라가면 된다.
+
+#define MSBFS_WIDTH 64
+#define DIST8_NONE 0xFF
+#define DIST16_NONE 0xFFFF
+
+typedef struct {
+    int n;
+    unsigned char* d8;      // 둘 중 하나만 쓴다
+    unsigned short* d16;
+} DistanceMatrix;
+
+void freeDistanceMatrix(DistanceMatrix* dm) {
+    if (dm == NULL) return;
+    free(dm->d8);
+    free(dm->d16);
+    free(dm);
+}
+
+// s에서 t까지의 홉 수, 경로가 없으면 INF
+int getDistance(const DistanceMatrix* dm, int s, int t) {
+    size_t i = (size_t)s * dm->n + t;
+    if (dm->d16 != NULL) return dm->d16[i] == DIST16_NONE ? INF : dm->d16[i];
+    return dm->d8[i] == DIST8_NONE ? INF : dm->d8[i];
+}
+
+static void setDistance(DistanceMatrix* dm, int s, int t, int d) {
+    size_t i = (size_t)s * dm->n + t;
+    if (dm->d16 != NULL) dm->d16[i] = (unsigned short)d;
+    else dm->d8[i] = (unsigned char)d;
+}
+
+static bool widenDistances(DistanceMatrix* dm) {
+    size_t cells = (size_t)dm->n * dm->n;
+    unsigned short* wide = (unsigned short*)malloc(sizeof(unsigned short) * cells);
+    if (wide == NULL) return false;
+    for (size_t i = 0; i < cells; i++) {
+        wide[i] = dm->d8[i] == DIST8_NONE ? DIST16_NONE : dm->d8[i];
+    }
+    free(dm->d8);
+    dm->d8 = NULL;
+    dm->d16 = wide;
+    return true;
+}
+
+// 모든 쌍의 홉 수. 메모리가 모자라거나 거리가 65534를 넘으면 NULL
+DistanceMatrix* allPairsHops(const Graph* g) {
+    int n = g->numVertices;
+    DistanceMatrix* dm = (DistanceMatrix*)calloc(1, sizeof(DistanceMatrix));
+    unsigned long long* seen = (unsigned long long*)malloc(sizeof(unsigned long long) * n);
+    unsigned long long* visit = (unsigned long long*)malloc(sizeof(unsigned long long) * n);
+    unsigned long long* next = (unsigned long long*)malloc(sizeof(unsigned long long) * n);
+    if (dm != NULL) {
+        dm->n = n;
+        dm->d8 = (unsigned char*)malloc((size_t)n * n);
+    }
+    if (dm == NULL || dm->d8 == NULL || seen == NULL || visit == NULL || next == NULL) {
+        freeDistanceMatrix(dm);
+        free(seen);
+        free(visit);
+        free(next);
+        return NULL;
+    }
+    memset(dm->d8, DIST8_NONE, (size_t)n * n);
+
+    for (int base = 0; base < n; base += MSBFS_WIDTH) {
+        int count = n - base < MSBFS_WIDTH ? n - base : MSBFS_WIDTH;
+        memset(seen, 0, sizeof(unsigned long long) * n);
+        memset(visit, 0, sizeof(unsigned long long) * n);
+        for (int i = 0; i < count; i++) {
+            seen[base + i] = visit[base + i] = 1ULL << i;
+            setDistance(dm, base + i, base + i, 0);
+        }
+
+        bool active = true;
+        for (int level = 1; active; level++) {
+            if (dm->d16 == NULL && level >= DIST8_NONE && !widenDistances(dm)) break;
+            if (level >= DIST16_NONE) break;
+
+            memset(next, 0, sizeof(unsigned long long) * n);
+            for (int v = 0; v < n; v++) {
+                unsigned long long bits = visit[v];
+                if (bits == 0) continue;
+                for (long long k = g->offsets[v]; k < g->offsets[v + 1]; k++) {
+                    next[g->neighbors[k]] |= bits;
+                }
+            }
+
+            active = false;
+            for (int u = 0; u < n; u++) {
+                unsigned long long fresh = next[u] & ~seen[u];
+                visit[u] = fresh;
+                if (fresh == 0) continue;
+                seen[u] |= fresh;
+                active = true;
+                while (fresh) {
+                    setDistance(dm, base + __builtin_ctzll(fresh), u, level);
+                    fresh &= fresh - 1;
+                }
+            }
+        }
+        if (active) {
+            // 넓히지 못했거나 거리가 너무 길다
+            freeDistanceMatrix(dm);
+            dm = NULL;
+            break;
+        }
+    }
+
+    free(seen);
+    free(visit);
+    free(next);
+    return dm;
+}
+
+// s에서 t까지의 최단 경로를 path[0] = s .. path[d] = t에 쓰고 정점 수를
+// 돌려준다 (경로가 없으면 0). path는 getDistance(s, t) + 1칸이면 된다.
+int reconstructPath(const Graph* g, const DistanceMatrix* dm, int s, int t, int path[]) {
+    int d = getDistance(dm, s, t);
+    if (d == INF) return 0;
+    path[d] = t;
+    for (int step = d; step > 0; step--) {
+        int cur = path[step];
+        for (long long k = g->offsets[cur]; k < g->offsets[cur + 1]; k++) {
+            int u = g->neighbors[k];
+            if (getDistance(dm, s, u) == step - 1) {
+                path[step - 1] = u;
+                break;
+            }
+        }
+    }
+    return d + 1;
+}
+
+#ifdef _WIN32
+long long getTimeNs() {
+    LARGE_INTEGER freq, counter;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (long long)((double)counter.QuadPart * 1e9 / freq.QuadPart);
+}
+#else
+long long getTimeNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+#endif
+
+// 대형 희소 그래프에서 단일 스레드 BFS와 병렬 방향 최적화 BFS 비교
+void benchmarkLargeBFS() {
+    unsigned long long seed = (unsigned long long)time(NULL);
+    Graph* g = createRandomSparseGraph(LARGE_V, LARGE_E, seed);
+    int* dist = (int*)malloc(sizeof(int) * LARGE_V);
+    int* parent = (int*)malloc(sizeof(int) * LARGE_V);
+    int* checkDist = (int*)malloc(sizeof(int) * LARGE_V);
+    if (g == NULL || dist == NULL || parent == NULL || checkDist == NULL) {
+        printf("대형 그래프 메모리 할당 실패\n");
+        freeGraph(g);
+        free(dist);
+        free(parent);
+        free(checkDist);
+        return;
+    }
+
+    printf("대형 그래프 BFS (정점 %d개, 간선 %lld개, 스레드 %d개)\n", LARGE_V, LARGE_E, cpuCount());
+    long long t0 = getTimeNs();
+    int reachedSerial = sparseBFS(g, 0, checkDist, parent);
+    double serialMs = (getTimeNs() - t0) / 1e6;
+
+    BFSStats stats;
+    t0 = getTimeNs();
+    int reachedParallel = parallelBFS(g, 0, dist, parent, 0, &stats);
+    double parallelMs = (getTimeNs() - t0) / 1e6;
+
+    bool same = reachedSerial == reachedParallel &&
+                memcmp(dist, checkDist, sizeof(int) * LARGE_V) == 0;
+    printf("  단일 스레드 BFS: %.1f ms (도달 %d개)\n", serialMs, reachedSerial);
+    printf("  병렬 방향 최적화 BFS: %.1f ms (도달 %d개, 하향식 %d단계, 상향식 %d단계)\n",
+           parallelMs, reachedParallel, stats.topDownSteps, stats.bottomUpSteps);
+    printf("  거리 일치: %s\n\n", same ? "예" : "아니오");
+
+    freeGraph(g);
+    free(dist);
+    free(parent);
+    free(checkDist);
+}
+
+// 정점 수천 개의 전체 쌍: 출발점마다 BFS vs MS-BFS
+void benchmarkAllPairs() {
+    Graph* g = createRandomSparseGraph(APSP_V, APSP_E, (unsigned long long)time(NULL));
+    int* dist = (int*)malloc(sizeof(int) * APSP_V);
+    int* parent = (int*)malloc(sizeof(int) * APSP_V);
+    if (g == NULL || dist == NULL || parent == NULL) {
+        printf("전체 쌍 벤치마크 메모리 할당 실패\n");
+        freeGraph(g);
+        free(dist);
+        free(parent);
+        return;
+    }
+
+    printf("전체 쌍 최단 홉 수 (정점 %d개, 간선 %d개)\n", APSP_V, APSP_E);
+    long long t0 = getTimeNs();
+    DistanceMatrix* dm = allPairsHops(g);
+    double msbfsMs = (getTimeNs() - t0) / 1e6;
+
+    t0 = getTimeNs();
+    int mismatches = 0;
+    for (int s = 0; s < APSP_V; s++) {
+        sparseBFS(g, s, dist, parent);
+        for (int t = 0; dm != NULL && t < APSP_V; t++) {
+            if (getDistance(dm, s, t) != dist[t]) mismatches++;
+        }
+    }
+    double serialMs = (getTimeNs() - t0) / 1e6;
+
+    printf("  출발점마다 BFS (검증 포함): %.1f ms\n", serialMs);
+    if (dm != NULL) {
+        printf("  MS-BFS (%d개씩): %.1f ms, 거리 행렬 %zu Bytes (%d바이트/쌍)\n",
+               MSBFS_WIDTH, msbfsMs, (size_t)APSP_V * APSP_V * (dm->d16 ? 2 : 1), dm->d16 ? 2 : 1);
+        printf("  거리 일치: %s\n\n", mismatches == 0 ? "예" : "아니오");
+    } else {
+        printf("  MS-BFS 실패 (메모리 부족)\n\n");
+    }
+
+    freeDistanceMatrix(dm);
+    freeGraph(g);
+    free(dist);
+    free(parent);
+}
+
+// 원형 버퍼 큐와 SPSC 큐의 처리량, 큐 재사용이 BFS에 주는 차이
+static void spscBackoff(int* spins) {
+    if (++*spins < SPSC_SPINS) return;
+    *spins = 0;
+#ifdef _WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+#ifdef _WIN32
+static DWORD WINAPI spscProducer(LPVOID arg) {
+#else
+static void* spscProducer(void* arg) {
+#endif
+    SPSCQueue* q = (SPSCQueue*)arg;
+    int spins = 0;
+    for (int i = 1; i <= QUEUE_BENCH_OPS; i++) {
+        while (!spscPush(q, i)) {
+            spscBackoff(&spins);
+        }
+    }
+    return 0;
+}
+
+void benchmarkQueues() {
+    printf("큐 처리량 (원소 %d개)\n", QUEUE_BENCH_OPS);
+
+    // 빈 용량에서 시작해 QUEUE_BENCH_BATCH개씩 넣고 뺀다
+    Queue q;
+    if (!initQueue(&q, 0)) {
+        printf("큐 메모리 할당 실패\n");
+        return;
+    }
+    long long sum = 0;
+    long long t0 = getTimeNs();
+    for (int done = 0; done < QUEUE_BENCH_OPS; done += QUEUE_BENCH_BATCH) {
+        for (int i = 0; i < QUEUE_BENCH_BATCH; i++) {
+            enqueue(&q, done + i);
+        }
+        while (!isEmpty(&q)) {
+            sum += dequeue(&q);
+        }
+    }
+    double ringMs = (getTimeNs() - t0) / 1e6;
+    long long expected = (long long)QUEUE_BENCH_OPS * (QUEUE_BENCH_OPS - 1) / 2;
+    printf("  원형 버퍼 큐: %.1f ms (%.0f M 원소/초, 합계 %s)\n", ringMs,
+           QUEUE_BENCH_OPS / ringMs / 1e3, sum == expected ? "일치" : "불일치");
+
+    // 생산자 스레드 하나, 소비자는 이 스레드
+    SPSCQueue* spsc = (SPSCQueue*)malloc(sizeof(SPSCQueue));
+    if (spsc != NULL && initSPSCQueue(spsc, SPSC_CAPACITY)) {
+        bool started;
+        t0 = getTimeNs();
+#ifdef _WIN32
+        HANDLE handle = CreateThread(NULL, 0, spscProducer, spsc, 0, NULL);
+        started = handle != NULL;
+#else
+        pthread_t handle;
+        started = pthread_create(&handle, NULL, spscProducer, spsc) == 0;
+#endif
+        if (started) {
+            int spins = 0;
+            sum = 0;
+            for (int received = 0; received < QUEUE_BENCH_OPS; ) {
+                int value;
+                if (spscPop(spsc, &value)) {
+                    sum += value;
+                    received++;
+                } else {
+                    spscBackoff(&spins);
+                }
+            }
+#ifdef _WIN32
+            WaitForSingleObject(handle, INFINITE);
+            CloseHandle(handle);
+#else
+            pthread_join(handle, NULL);
+#endif
+            double spscMs = (getTimeNs() - t0) / 1e6;
+            expected = (long long)QUEUE_BENCH_OPS * (QUEUE_BENCH_OPS + 1) / 2;
+            printf("  SPSC 큐 (스레드 2개, 용량 %d): %.1f ms (%.0f M 원소/초, 합계 %s)\n", SPSC_CAPACITY,
+                   spscMs, QUEUE_BENCH_OPS / spscMs / 1e3, sum == expected ? "일치" : "불일치");
+        } else {
+            printf("  SPSC 큐: 스레드 생성 실패\n");
+        }
+        freeSPSCQueue(spsc);
+    }
+    free(spsc);
+
+    // 출발점마다 BFS: 매번 큐를 새로 만들 때와 하나를 다시 쓸 때
+    Graph* g = createRandomSparseGraph(APSP_V, APSP_E, (unsigned long long)time(NULL));
+    int* dist = (int*)malloc(sizeof(int) * APSP_V);
+    int* parent = (int*)malloc(sizeof(int) * APSP_V);
+    if (g != NULL && dist != NULL && parent != NULL) {
+        long long reachedFresh = 0, reachedReused = 0;
+        t0 = getTimeNs();
+        for (int s = 0; s < APSP_V; s++) {
+            reachedFresh += sparseBFS(g, s, dist, parent);
+        }
+        double freshMs = (getTimeNs() - t0) / 1e6;
+
+        t0 = getTimeNs();
+        for (int s = 0; s < APSP_V; s++) {
+            reachedReused += sparseBFSWithQueue(g, s, dist, parent, &q);
+        }
+        double reusedMs = (getTimeNs() - t0) / 1e6;
+
+        printf("  BFS %d회 (정점 %d개): 큐 새로 할당 %.1f ms, 큐 재사용 %.1f ms (용량 %u, 결과 %s)\n\n",
+               APSP_V, APSP_V, freshMs, reusedMs, q.mask + 1,
+               reachedFresh == reachedReused ? "일치" : "불일치");
+    }
+    freeGraph(g);
+    free(dist);
+    free(parent);
+    freeQueue(&q);
+}
+
+// 인자 -q: 정점 쌍별 출력을 생략한다
+int main(int argc, char* argv[]) {
     int graph[V][V];
     int dist[V];
     int parent[V];
+    bool printPairs = !(argc > 1 && strcmp(argv[1], "-q") == 0);
+    static char outputBuffer[OUTPUT_BUFFER_SIZE];
+    setvbuf(stdout, outputBuffer, _IOFBF, sizeof(outputBuffer));
     
     // 무작위 그래프 생성
     createRandomGraph(graph);
     
     // 그래프 출력
     printGraph(graph);
+
+    Graph* small = graphFromMatrix(graph);
+    DistanceMatrix* hops = small != NULL ? allPairsHops(small) : NULL;
+    if (hops == NULL) {
+        printf("메모리 할당 실패\n");
+        freeGraph(small);
+        return 1;
+    }
     
     // 모든 쌍의 최단 경로 계산 및 출력
-    printf("모든 정점 쌍 간의 최단 경로:\n");
-    printf("=================================================================\n\n");
-    
     int pairCount = 0;
+    if (printPairs) {
+        printf("모든 정점 쌍 간의 최단 경로:\n");
+        printf("=================================================================\n\n");
+    }
     for (int i = 0; i < V; i++) {
-        BFS(graph, i, dist, parent);
-        
         for (int j = i + 1; j < V; j++) {
             pairCount++;
+            if (!printPairs) continue;
             printf("쌍 %2d: 정점 %d -> 정점 %d\n", pairCount, i, j);
             
-            if (dist[j] == INF) {
+            int d = getDistance(hops, i, j);
+            if (d == INF) {
                 printf("  결과: 경로 없음\n");
             } else {
-                printf("  거리: %d 개의 간선\n", dist[j]);
-                printf("  경로: ");
-                printPath(parent, i, j);
+                int path[V];
+                int length = reconstructPath(small, hops, i, j, path);
+                printf("  거리: %d 개의 간선\n", d);
+                printf("  경로: %d", path[0]);
+                for (int k = 1; k < length; k++) {
+                    printf(" -> %d", path[k]);
+                }
                 printf("\n");
             }
             printf("\n");
         }
     }
     
-    printf("=================================================================\n");
+    if (printPairs) printf("=================================================================\n");
     printf("총 정점 쌍의 개수: %d\n", pairCount);
+
+    // 행렬 BFS와 병렬 BFS가 MS-BFS 거리와 같은지 확인
+    int mismatches = 0;
+    for (int i = 0; i < V; i++) {
+        int sparseDist[V], sparseParent[V];
+        BFS(graph, i, dist, parent);
+        parallelBFS(small, i, sparseDist, sparseParent, 0, NULL);
+        for (int j = 0; j < V; j++) {
+            if (dist[j] != sparseDist[j] || dist[j] != getDistance(hops, i, j)) mismatches++;
+        }
+    }
+    printf("병렬 BFS / MS-BFS 거리 검증: %s\n\n", mismatches == 0 ? "일치" : "불일치");
+    freeDistanceMatrix(hops);
+    freeGraph(small);
+    fflush(stdout);
+
+    benchmarkLargeBFS();
+    benchmarkAllPairs();
+    benchmarkQueues();
     
     return 0;
-}
\ No newline at end of file
+}